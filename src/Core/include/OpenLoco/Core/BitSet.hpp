@@ -333,6 +333,27 @@ namespace OpenLoco
             return reference(_data, blockIndex, blockOffset);
         }
 
+        // Returns the index of the first set bit at or after index, or size() if there is none
+        constexpr size_t findNext(size_t index) const noexcept
+        {
+            if (index >= TBitSize)
+            {
+                return TBitSize;
+            }
+
+            auto blockIndex = computeBlockIndex(index);
+            auto block = static_cast<StorageBlockType>(_data[blockIndex] & static_cast<StorageBlockType>(kBlockValueMask << computeBlockOffset(index)));
+            while (block == kBlockValueZero)
+            {
+                if (++blockIndex == kBlockCount)
+                {
+                    return TBitSize;
+                }
+                block = _data[blockIndex];
+            }
+            return std::min<size_t>(blockIndex * kBlockBitSize + std::countr_zero(block), TBitSize);
+        }
+
         constexpr BitSet& flip() noexcept
         {
             for (auto& data : _data)
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace OpenLoco::Core
+{
+    // A fixed set of worker threads that execute queued tasks in no particular order.
+    // Tasks must not throw and must not call back into the pool that is running them.
+    class JobPool
+    {
+    public:
+        using Task = std::function<void()>;
+
+    private:
+        std::vector<std::thread> _threads;
+        std::deque<Task> _pending;
+        size_t _processing = 0;
+        bool _shouldStop = false;
+
+        std::mutex _mutex;
+        std::condition_variable _condPending;
+        std::condition_variable _condComplete;
+
+    public:
+        // A value of 0 uses the number of hardware threads
+        explicit JobPool(size_t numThreads = 0);
+        ~JobPool();
+
+        JobPool(const JobPool&) = delete;
+        JobPool& operator=(const JobPool&) = delete;
+
+        void addTask(Task task);
+
+        // Blocks until all queued tasks have finished
+        void join();
+
+        size_t countPending();
+        size_t getNumThreads() const { return _threads.size(); }
+
+    private:
+        void processQueue();
+    };
+}
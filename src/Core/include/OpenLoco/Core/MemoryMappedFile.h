@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace OpenLoco
+{
+    // A read only view of a whole file, pages are only read from disk once they are accessed.
+    // Writes to the view are private to the process and never reach the file.
+    class MemoryMappedFile final
+    {
+    private:
+        std::byte* _data{};
+        size_t _length{};
+#ifdef _WIN32
+        void* _fileHandle{};
+        void* _mappingHandle{};
+#endif
+
+    public:
+        MemoryMappedFile() = default;
+        explicit MemoryMappedFile(const std::filesystem::path& path);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+        bool open(const std::filesystem::path& path);
+
+        bool isOpen() const noexcept;
+
+        void close();
+
+        size_t getLength() const noexcept { return _length; }
+
+        std::byte* data() noexcept { return _data; }
+        const std::byte* data() const noexcept { return _data; }
+
+        std::span<const std::byte> getSpan() const noexcept { return { _data, _length }; }
+    };
+}
@@ -0,0 +1,85 @@
+#include "JobPool.hpp"
+#include <algorithm>
+
+namespace OpenLoco::Core
+{
+    JobPool::JobPool(size_t numThreads)
+    {
+        if (numThreads == 0)
+        {
+            numThreads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        }
+
+        _threads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i)
+        {
+            _threads.emplace_back([this] { processQueue(); });
+        }
+    }
+
+    JobPool::~JobPool()
+    {
+        {
+            std::unique_lock lock(_mutex);
+            _shouldStop = true;
+        }
+        _condPending.notify_all();
+
+        for (auto& thread : _threads)
+        {
+            if (thread.joinable())
+            {
+                thread.join();
+            }
+        }
+    }
+
+    void JobPool::addTask(Task task)
+    {
+        {
+            std::unique_lock lock(_mutex);
+            _pending.push_back(std::move(task));
+        }
+        _condPending.notify_one();
+    }
+
+    void JobPool::join()
+    {
+        std::unique_lock lock(_mutex);
+        _condComplete.wait(lock, [this] { return _pending.empty() && _processing == 0; });
+    }
+
+    size_t JobPool::countPending()
+    {
+        std::unique_lock lock(_mutex);
+        return _pending.size();
+    }
+
+    void JobPool::processQueue()
+    {
+        std::unique_lock lock(_mutex);
+        while (true)
+        {
+            _condPending.wait(lock, [this] { return _shouldStop || !_pending.empty(); });
+            if (_pending.empty())
+            {
+                // Only reachable when stopping
+                break;
+            }
+
+            auto task = std::move(_pending.front());
+            _pending.pop_front();
+            _processing++;
+
+            lock.unlock();
+            task();
+            lock.lock();
+
+            _processing--;
+            if (_pending.empty() && _processing == 0)
+            {
+                _condComplete.notify_all();
+            }
+        }
+    }
+}
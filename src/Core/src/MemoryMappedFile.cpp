@@ -0,0 +1,162 @@
+#include "MemoryMappedFile.h"
+#include "Exception.hpp"
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace OpenLoco
+{
+    MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path)
+    {
+        if (!open(path))
+        {
+            throw Exception::RuntimeError("Failed to map '" + path.u8string() + "'");
+        }
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            _data = std::exchange(other._data, nullptr);
+            _length = std::exchange(other._length, 0);
+#ifdef _WIN32
+            _fileHandle = std::exchange(other._fileHandle, nullptr);
+            _mappingHandle = std::exchange(other._mappingHandle, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MemoryMappedFile::open(const std::filesystem::path& path)
+    {
+        close();
+
+        auto file = CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(file, &size) || size.QuadPart == 0 || static_cast<uint64_t>(size.QuadPart) > SIZE_MAX)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        // Copy on write so that the view can be patched without touching the file
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mapping == nullptr)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        auto* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        if (view == nullptr)
+        {
+            CloseHandle(mapping);
+            CloseHandle(file);
+            return false;
+        }
+
+        _fileHandle = file;
+        _mappingHandle = mapping;
+        _data = static_cast<std::byte*>(view);
+        _length = static_cast<size_t>(size.QuadPart);
+        return true;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+            _data = nullptr;
+        }
+        if (_mappingHandle != nullptr)
+        {
+            CloseHandle(_mappingHandle);
+            _mappingHandle = nullptr;
+        }
+        if (_fileHandle != nullptr)
+        {
+            CloseHandle(_fileHandle);
+            _fileHandle = nullptr;
+        }
+        _length = 0;
+    }
+#else
+    bool MemoryMappedFile::open(const std::filesystem::path& path)
+    {
+        close();
+
+        const auto fd = ::open(path.u8string().c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat info
+        {
+        };
+        if (fstat(fd, &info) != 0 || info.st_size <= 0 || static_cast<uint64_t>(info.st_size) > SIZE_MAX)
+        {
+            ::close(fd);
+            return false;
+        }
+        const auto length = static_cast<size_t>(info.st_size);
+
+        // Private mapping so that the view can be patched without touching the file
+        auto* view = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+        if (view == MAP_FAILED)
+        {
+            return false;
+        }
+
+        _data = static_cast<std::byte*>(view);
+        _length = length;
+        return true;
+    }
+
+    void MemoryMappedFile::close()
+    {
+        if (_data != nullptr)
+        {
+            munmap(_data, _length);
+            _data = nullptr;
+        }
+        _length = 0;
+    }
+#endif
+
+    bool MemoryMappedFile::isOpen() const noexcept
+    {
+        return _data != nullptr;
+    }
+}
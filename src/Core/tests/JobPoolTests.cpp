@@ -0,0 +1,62 @@
+#include <OpenLoco/Core/JobPool.hpp>
+#include <atomic>
+#include <gtest/gtest.h>
+
+using namespace OpenLoco;
+
+TEST(JobPoolTests, runsAllTasks)
+{
+    Core::JobPool pool(4);
+    EXPECT_EQ(pool.getNumThreads(), 4U);
+
+    std::atomic<int32_t> counter = 0;
+    for (auto i = 0; i < 1000; ++i)
+    {
+        pool.addTask([&counter] { counter++; });
+    }
+    pool.join();
+
+    EXPECT_EQ(counter, 1000);
+    EXPECT_EQ(pool.countPending(), 0U);
+}
+
+TEST(JobPoolTests, disjointWrites)
+{
+    Core::JobPool pool;
+    EXPECT_GE(pool.getNumThreads(), 1U);
+
+    std::vector<int32_t> results(256);
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        pool.addTask([&results, i] { results[i] = static_cast<int32_t>(i) * 2; });
+    }
+    pool.join();
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        EXPECT_EQ(results[i], static_cast<int32_t>(i) * 2);
+    }
+}
+
+TEST(JobPoolTests, reuseAfterJoin)
+{
+    Core::JobPool pool(2);
+
+    std::atomic<int32_t> counter = 0;
+    for (auto round = 0; round < 3; ++round)
+    {
+        for (auto i = 0; i < 10; ++i)
+        {
+            pool.addTask([&counter] { counter++; });
+        }
+        pool.join();
+        EXPECT_EQ(counter, (round + 1) * 10);
+    }
+}
+
+TEST(JobPoolTests, joinWithoutTasks)
+{
+    Core::JobPool pool(1);
+    pool.join();
+    EXPECT_EQ(pool.countPending(), 0U);
+}
@@ -0,0 +1,75 @@
+#include <OpenLoco/Core/LocoFixedVector.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+
+struct TestEntry
+{
+    int value;
+
+    bool empty() const { return value == 0; }
+};
+
+template<typename TFixedVector>
+static std::vector<int> collect(const TFixedVector& entries)
+{
+    std::vector<int> values;
+    for (auto& entry : entries)
+    {
+        values.push_back(entry.value);
+    }
+    return values;
+}
+
+TEST(BitSetTests, findNext)
+{
+    BitSet<200> bits;
+    EXPECT_EQ(bits.findNext(0), 200);
+
+    bits.set(0, true);
+    bits.set(63, true);
+    bits.set(64, true);
+    bits.set(199, true);
+    EXPECT_EQ(bits.findNext(0), 0);
+    EXPECT_EQ(bits.findNext(1), 63);
+    EXPECT_EQ(bits.findNext(64), 64);
+    EXPECT_EQ(bits.findNext(65), 199);
+    EXPECT_EQ(bits.findNext(200), 200);
+
+    BitSet<12> small{ 3, 11 };
+    EXPECT_EQ(small.findNext(0), 3);
+    EXPECT_EQ(small.findNext(4), 11);
+    EXPECT_EQ(small.findNext(12), 12);
+}
+
+TEST(LocoFixedVectorTests, skipsEmpty)
+{
+    TestEntry entries[8] = { { 0 }, { 1 }, { 0 }, { 0 }, { 4 }, { 0 }, { 0 }, { 7 } };
+    const auto vector = FixedVector(entries);
+    EXPECT_EQ(collect(vector), (std::vector<int>{ 1, 4, 7 }));
+    EXPECT_EQ(vector.size(), 3);
+}
+
+TEST(LocoFixedVectorTests, occupancy)
+{
+    TestEntry entries[130]{};
+    FixedVector<TestEntry, 130>::Occupancy occupancy;
+    EXPECT_TRUE(FixedVector(entries, occupancy).empty());
+
+    for (const auto index : { 2, 64, 129 })
+    {
+        entries[index].value = index;
+        occupancy.set(index, true);
+    }
+    EXPECT_EQ(collect(FixedVector(entries, occupancy)), (std::vector<int>{ 2, 64, 129 }));
+
+    // Entries emptied without clearing their bit are still skipped
+    entries[64].value = 0;
+    EXPECT_EQ(collect(FixedVector(entries, occupancy)), (std::vector<int>{ 2, 129 }));
+
+    // Entries without their bit set are never visited
+    entries[5].value = 5;
+    EXPECT_EQ(collect(FixedVector(entries, occupancy)), (std::vector<int>{ 2, 129 }));
+    EXPECT_EQ(collect(FixedVector(entries)), (std::vector<int>{ 2, 5, 129 }));
+}
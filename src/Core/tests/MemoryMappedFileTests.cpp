@@ -0,0 +1,105 @@
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/MemoryMappedFile.h>
+#include <cstdio>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace OpenLoco;
+
+static std::filesystem::path getTempFilePath()
+{
+    char tempNameBuf[L_tmpnam]{};
+#ifdef _MSC_VER
+    tmpnam_s(tempNameBuf, L_tmpnam);
+    const char* tempName = tempNameBuf;
+#else
+    const char* tempName = tmpnam(tempNameBuf);
+#endif
+    auto tempDir = std::filesystem::temp_directory_path();
+    auto tempFile = tempDir / tempName;
+    return tempFile;
+}
+
+static std::vector<std::byte> generateFile(const std::filesystem::path& filePath, size_t dataLength)
+{
+    std::vector<std::byte> data(dataLength);
+    for (size_t i = 0; i < dataLength; i++)
+    {
+        data[i] = static_cast<std::byte>(i * 7 % 256);
+    }
+    FileStream streamOut(filePath, StreamMode::write);
+    streamOut.write(data.data(), data.size());
+    return data;
+}
+
+TEST(MemoryMappedFileTest, testMapContents)
+{
+    const auto filePath = getTempFilePath();
+    // Spans several pages
+    const auto data = generateFile(filePath, 0x12345);
+
+    {
+        MemoryMappedFile file(filePath);
+        ASSERT_TRUE(file.isOpen());
+        ASSERT_EQ(file.getLength(), data.size());
+
+        const auto span = file.getSpan();
+        EXPECT_TRUE(std::equal(span.begin(), span.end(), data.begin(), data.end()));
+    }
+
+    std::filesystem::remove(filePath);
+}
+
+TEST(MemoryMappedFileTest, testWritesArePrivate)
+{
+    const auto filePath = getTempFilePath();
+    const auto data = generateFile(filePath, 64);
+
+    {
+        MemoryMappedFile file(filePath);
+        ASSERT_TRUE(file.isOpen());
+        file.data()[10] = std::byte{ 0xFF };
+        EXPECT_EQ(file.data()[10], std::byte{ 0xFF });
+    }
+
+    {
+        MemoryMappedFile file(filePath);
+        ASSERT_TRUE(file.isOpen());
+        EXPECT_EQ(file.data()[10], data[10]);
+    }
+
+    std::filesystem::remove(filePath);
+}
+
+TEST(MemoryMappedFileTest, testMove)
+{
+    const auto filePath = getTempFilePath();
+    const auto data = generateFile(filePath, 16);
+
+    {
+        MemoryMappedFile file(filePath);
+        MemoryMappedFile moved = std::move(file);
+        EXPECT_FALSE(file.isOpen());
+        EXPECT_EQ(file.getLength(), 0);
+        ASSERT_TRUE(moved.isOpen());
+        EXPECT_EQ(moved.getLength(), data.size());
+        EXPECT_EQ(moved.data()[3], data[3]);
+
+        moved.close();
+        EXPECT_FALSE(moved.isOpen());
+    }
+
+    std::filesystem::remove(filePath);
+}
+
+TEST(MemoryMappedFileTest, testMissingFile)
+{
+    const auto filePath = getTempFilePath();
+
+    MemoryMappedFile file;
+    EXPECT_FALSE(file.open(filePath));
+    EXPECT_FALSE(file.isOpen());
+    EXPECT_THROW(MemoryMappedFile{ filePath }, Exception::RuntimeError);
+}
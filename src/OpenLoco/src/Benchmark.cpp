@@ -0,0 +1,228 @@
+#include "Benchmark.h"
+#include "GameState.h"
+#include "OpenLoco.h"
+#include <OpenLoco/Core/EnumFlags.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <algorithm>
+#include <cmath>
+#include <fmt/format.h>
+#include <numeric>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Benchmark
+{
+    using ClockType = std::chrono::high_resolution_clock;
+
+    static constexpr std::array<std::string_view, kNumSubsystems> kSubsystemNames = {
+        "TileManager",
+        "TownManager",
+        "IndustryManager",
+        "VehicleManager",
+        "StationManager",
+        "EffectsManager",
+        "CompanyManager",
+        "AnimationManager",
+    };
+
+    struct SubsystemTimes
+    {
+        std::chrono::nanoseconds total{};
+        std::chrono::nanoseconds max{};
+        std::chrono::nanoseconds currentTick{};
+    };
+
+    static bool _enabled = false;
+    static ClockType::time_point _tickStart;
+    static std::vector<std::chrono::nanoseconds> _tickTimes;
+    static std::array<SubsystemTimes, kNumSubsystems> _subsystemTimes;
+
+    std::string_view getSubsystemName(Subsystem subsystem)
+    {
+        return kSubsystemNames[enumValue(subsystem)];
+    }
+
+    void setEnabled(bool enabled)
+    {
+        _enabled = enabled;
+    }
+
+    bool isEnabled()
+    {
+        return _enabled;
+    }
+
+    void reset()
+    {
+        _tickTimes.clear();
+        _subsystemTimes = {};
+    }
+
+    void beginTick()
+    {
+        if (!_enabled)
+        {
+            return;
+        }
+        for (auto& times : _subsystemTimes)
+        {
+            times.currentTick = {};
+        }
+        _tickStart = ClockType::now();
+    }
+
+    void endTick()
+    {
+        if (!_enabled)
+        {
+            return;
+        }
+        _tickTimes.push_back(ClockType::now() - _tickStart);
+        for (auto& times : _subsystemTimes)
+        {
+            times.max = std::max(times.max, times.currentTick);
+        }
+    }
+
+    void addSubsystemTime(Subsystem subsystem, std::chrono::nanoseconds duration)
+    {
+        auto& times = _subsystemTimes[enumValue(subsystem)];
+        times.total += duration;
+        times.currentTick += duration;
+    }
+
+    static double toMs(std::chrono::nanoseconds duration)
+    {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    }
+
+    // Nearest rank percentile of a sorted range
+    static double getPercentileMs(const std::vector<std::chrono::nanoseconds>& sorted, double percentile)
+    {
+        if (sorted.empty())
+        {
+            return 0.0;
+        }
+        const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * sorted.size()));
+        return toMs(sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1]);
+    }
+
+    Results getResults()
+    {
+        Results results{};
+        results.ticks = static_cast<uint32_t>(_tickTimes.size());
+        if (_tickTimes.empty())
+        {
+            return results;
+        }
+
+        auto sorted = _tickTimes;
+        std::sort(sorted.begin(), sorted.end());
+        const auto total = std::accumulate(sorted.begin(), sorted.end(), std::chrono::nanoseconds{});
+
+        results.totalMs = toMs(total);
+        results.tick.meanMs = results.totalMs / results.ticks;
+        results.tick.minMs = toMs(sorted.front());
+        results.tick.p50Ms = getPercentileMs(sorted, 50);
+        results.tick.p90Ms = getPercentileMs(sorted, 90);
+        results.tick.p99Ms = getPercentileMs(sorted, 99);
+        results.tick.maxMs = toMs(sorted.back());
+
+        for (size_t i = 0; i < kNumSubsystems; ++i)
+        {
+            const auto& times = _subsystemTimes[i];
+            auto& stats = results.subsystems[i];
+            stats.totalMs = toMs(times.total);
+            stats.meanMs = stats.totalMs / results.ticks;
+            stats.maxMs = toMs(times.max);
+        }
+        return results;
+    }
+
+    void logResults(const Results& results)
+    {
+        Logging::info("Ticks:");
+        Logging::info("  count:    {}", results.ticks);
+        Logging::info("  total:    {:.3f} ms", results.totalMs);
+        if (results.totalMs > 0.0)
+        {
+            Logging::info("  rate:     {:.1f} ticks/sec", results.ticks * 1000.0 / results.totalMs);
+        }
+        Logging::info("  mean:     {:.4f} ms", results.tick.meanMs);
+        Logging::info("  min:      {:.4f} ms", results.tick.minMs);
+        Logging::info("  p50:      {:.4f} ms", results.tick.p50Ms);
+        Logging::info("  p90:      {:.4f} ms", results.tick.p90Ms);
+        Logging::info("  p99:      {:.4f} ms", results.tick.p99Ms);
+        Logging::info("  max:      {:.4f} ms", results.tick.maxMs);
+        Logging::info("Subsystems:          total ms     mean ms      max ms   share");
+        for (size_t i = 0; i < kNumSubsystems; ++i)
+        {
+            const auto& stats = results.subsystems[i];
+            const auto share = results.totalMs > 0.0 ? stats.totalMs * 100.0 / results.totalMs : 0.0;
+            Logging::info("  {:<16} {:>11.3f} {:>11.4f} {:>11.4f} {:>6.2f}%", kSubsystemNames[i], stats.totalMs, stats.meanMs, stats.maxMs, share);
+        }
+    }
+
+    std::string escapeJsonString(std::string_view str)
+    {
+        std::string result;
+        result.reserve(str.size());
+        for (const auto c : str)
+        {
+            switch (c)
+            {
+                case '"':
+                    result += "\\\"";
+                    break;
+                case '\\':
+                    result += "\\\\";
+                    break;
+                default:
+                    if (static_cast<uint8_t>(c) < 0x20)
+                    {
+                        result += fmt::format("\\u{:04x}", static_cast<uint8_t>(c));
+                    }
+                    else
+                    {
+                        result += c;
+                    }
+                    break;
+            }
+        }
+        return result;
+    }
+
+    void writeResultsJson(const fs::path& path, const fs::path& inputPath, const Results& results)
+    {
+        const auto& gameState = getGameState();
+
+        std::string json = "{\n";
+        json += fmt::format("  \"version\": \"{}\",\n", escapeJsonString(getVersionInfo()));
+        json += fmt::format("  \"path\": \"{}\",\n", escapeJsonString(inputPath.u8string()));
+        json += fmt::format("  \"ticks\": {},\n", results.ticks);
+        json += fmt::format("  \"scenario_ticks\": {},\n", gameState.scenarioTicks);
+        json += fmt::format("  \"rng\": [{}, {}],\n", gameState.rng.srand_0(), gameState.rng.srand_1());
+        json += fmt::format("  \"total_ms\": {:.6f},\n", results.totalMs);
+        json += "  \"tick_ms\": {\n";
+        json += fmt::format("    \"mean\": {:.6f},\n", results.tick.meanMs);
+        json += fmt::format("    \"min\": {:.6f},\n", results.tick.minMs);
+        json += fmt::format("    \"p50\": {:.6f},\n", results.tick.p50Ms);
+        json += fmt::format("    \"p90\": {:.6f},\n", results.tick.p90Ms);
+        json += fmt::format("    \"p99\": {:.6f},\n", results.tick.p99Ms);
+        json += fmt::format("    \"max\": {:.6f}\n", results.tick.maxMs);
+        json += "  },\n";
+        json += "  \"subsystems\": {\n";
+        for (size_t i = 0; i < kNumSubsystems; ++i)
+        {
+            const auto& stats = results.subsystems[i];
+            json += fmt::format("    \"{}\": {{ \"total_ms\": {:.6f}, \"mean_ms\": {:.6f}, \"max_ms\": {:.6f} }}{}\n", kSubsystemNames[i], stats.totalMs, stats.meanMs, stats.maxMs, i + 1 < kNumSubsystems ? "," : "");
+        }
+        json += "  }\n";
+        json += "}\n";
+
+        FileStream stream(path, StreamMode::write);
+        stream.write(json.data(), json.size());
+    }
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace OpenLoco::Benchmark
+{
+    // Managers updated from tickLogic that are timed individually
+    enum class Subsystem : uint8_t
+    {
+        tileManager,
+        townManager,
+        industryManager,
+        vehicleManager,
+        stationManager,
+        effectsManager,
+        companyManager,
+        animationManager,
+    };
+    constexpr size_t kNumSubsystems = 8;
+
+    std::string_view getSubsystemName(Subsystem subsystem);
+
+    // When enabled tickLogic records the wall time of every tick and subsystem update
+    void setEnabled(bool enabled);
+    bool isEnabled();
+    void reset();
+
+    // Enables the benchmark for its lifetime, including when leaving through an exception
+    class ScopedEnable
+    {
+    public:
+        ScopedEnable() { setEnabled(true); }
+        ~ScopedEnable() { setEnabled(false); }
+
+        ScopedEnable(const ScopedEnable&) = delete;
+        ScopedEnable& operator=(const ScopedEnable&) = delete;
+    };
+
+    void beginTick();
+    void endTick();
+    void addSubsystemTime(Subsystem subsystem, std::chrono::nanoseconds duration);
+
+    class ScopedSubsystemTimer
+    {
+        using ClockType = std::chrono::high_resolution_clock;
+
+        Subsystem _subsystem;
+        bool _enabled;
+        ClockType::time_point _start;
+
+    public:
+        explicit ScopedSubsystemTimer(Subsystem subsystem)
+            : _subsystem(subsystem)
+            , _enabled(isEnabled())
+        {
+            if (_enabled)
+            {
+                _start = ClockType::now();
+            }
+        }
+
+        ~ScopedSubsystemTimer()
+        {
+            if (_enabled)
+            {
+                addSubsystemTime(_subsystem, ClockType::now() - _start);
+            }
+        }
+
+        ScopedSubsystemTimer(const ScopedSubsystemTimer&) = delete;
+        ScopedSubsystemTimer& operator=(const ScopedSubsystemTimer&) = delete;
+    };
+
+    struct TickStatistics
+    {
+        double meanMs;
+        double minMs;
+        double p50Ms;
+        double p90Ms;
+        double p99Ms;
+        double maxMs;
+    };
+
+    struct SubsystemStatistics
+    {
+        double totalMs;
+        double meanMs;
+        double maxMs;
+    };
+
+    struct Results
+    {
+        uint32_t ticks;
+        double totalMs;
+        TickStatistics tick;
+        std::array<SubsystemStatistics, kNumSubsystems> subsystems;
+    };
+
+    Results getResults();
+
+    void logResults(const Results& results);
+    std::string escapeJsonString(std::string_view str);
+    void writeResultsJson(const fs::path& path, const fs::path& inputPath, const Results& results);
+}
@@ -1,12 +1,19 @@
 #include "CommandLine.h"
+#include "Benchmark.h"
 #include "GameSaveCompare.h"
 #include "GameState.h"
+#include "Map/TileManager.h"
+#include "Network/LoopbackBenchmark.h"
 #include "OpenLoco.h"
 #include "S5/S5.h"
 #include "S5/SawyerStream.h"
+#include "SimulateBatch.h"
+#include "Vehicles/LocationOfInterest.h"
 #include <OpenLoco/Core/MemoryStream.h>
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <array>
 #include <chrono>
+#include <cstring>
 #include <fmt/chrono.h>
 #include <iostream>
 #include <optional>
@@ -21,6 +28,11 @@ namespace OpenLoco
 
     static int uncompressFile(const CommandLineOptions& options);
     static int simulate(const CommandLineOptions& options);
+    static int simulateBatch(const CommandLineOptions& options);
+    static int benchmark(const CommandLineOptions& options);
+    static int benchmarkCodecs(const CommandLineOptions& options);
+    static int benchmarkNetwork(const CommandLineOptions& options);
+    static int benchmarkRouting(const CommandLineOptions& options);
     static int compare(const CommandLineOptions& options);
 
     const CommandLineOptions& getCommandLineOptions()
@@ -301,7 +313,10 @@ namespace OpenLoco
                           .registerOption("--version")
                           .registerOption("--intro")
                           .registerOption("--log_levels", 1)
-                          .registerOption("--all", "-a");
+                          .registerOption("--all", "-a")
+                          .registerOption("--jobs", "-j", 1)
+                          .registerOption("--summary", "-s")
+                          .registerOption("--tile_index");
 
         if (!parser.parse())
         {
@@ -347,9 +362,42 @@ namespace OpenLoco
                 options.ticks = parser.getArg<int32_t>(2);
                 options.path2 = parser.getArg(3);
             }
+            else if (firstArg == "simulate_batch")
+            {
+                options.action = CommandLineAction::simulateBatch;
+                options.path = parser.getArg(1);
+                options.ticks = parser.getArg<int32_t>(2);
+                options.jobs = parser.getArg<int32_t>("--jobs");
+                if (!options.jobs)
+                    options.jobs = parser.getArg<int32_t>("-j");
+            }
+            else if (firstArg == "benchmark")
+            {
+                options.action = CommandLineAction::benchmark;
+                options.path = parser.getArg(1);
+                options.ticks = parser.getArg<int32_t>(2);
+                options.tileIndex = parser.hasOption("--tile_index");
+            }
+            else if (firstArg == "benchmark_codecs")
+            {
+                options.action = CommandLineAction::benchmarkCodecs;
+                options.path = parser.getArg(1);
+                options.iterations = parser.getArg<int32_t>(2);
+            }
+            else if (firstArg == "benchmark_network")
+            {
+                options.action = CommandLineAction::benchmarkNetwork;
+                options.packetLoss = parser.getArg<int32_t>(1);
+            }
+            else if (firstArg == "benchmark_routing")
+            {
+                options.action = CommandLineAction::benchmarkRouting;
+                options.iterations = parser.getArg<int32_t>(1);
+            }
             else if (firstArg == "compare")
             {
                 options.action = CommandLineAction::compare;
+                options.summaryOnly = parser.hasOption("--summary") || parser.hasOption("-s");
                 if (parser.hasOption("--all") || parser.hasOption("-a"))
                 {
                     options.all = "all";
@@ -395,12 +443,19 @@ namespace OpenLoco
         std::cout << "                join [options] <address>" << std::endl;
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks> [path]" << std::endl;
+        std::cout << "                simulate_batch [options] <directory|manifest> <ticks>" << std::endl;
+        std::cout << "                benchmark [options] <path> <ticks>" << std::endl;
+        std::cout << "                benchmark_codecs [options] <path> [iterations]" << std::endl;
+        std::cout << "                benchmark_network [options] [packet loss %]" << std::endl;
+        std::cout << "                benchmark_routing [options] [iterations]" << std::endl;
         std::cout << "                compare [options] <path1> <path2>" << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind            Address to bind to when hosting a server" << std::endl;
         std::cout << "--port     -p     Port number for the server" << std::endl;
-        std::cout << "           -o     Output path" << std::endl;
+        std::cout << "           -o     Output path (JSON results for benchmark and simulate_batch)" << std::endl;
+        std::cout << "--jobs     -j     Number of saves simulate_batch simulates at once" << std::endl;
+        std::cout << "--tile_index      Use the tile element index during benchmark" << std::endl;
         std::cout << "--help     -h     Print help" << std::endl;
         std::cout << "--version         Print version" << std::endl;
         std::cout << "--intro           Run the game intro" << std::endl;
@@ -410,6 +465,7 @@ namespace OpenLoco
         std::cout << "                  Example: --log_levels \"all, -verbose\", logs all but verbose levels" << std::endl;
         std::cout << "                  Default: \"info, warning, error\"" << std::endl;
         std::cout << "--all      -a     For compare, print out all divergences" << std::endl;
+        std::cout << "--summary  -s     For compare, only report the first divergent region" << std::endl;
     }
 
     std::optional<int> runCommandLineOnlyCommand(const CommandLineOptions& options)
@@ -426,6 +482,16 @@ namespace OpenLoco
                 return uncompressFile(options);
             case CommandLineAction::simulate:
                 return simulate(options);
+            case CommandLineAction::simulateBatch:
+                return simulateBatch(options);
+            case CommandLineAction::benchmark:
+                return benchmark(options);
+            case CommandLineAction::benchmarkCodecs:
+                return benchmarkCodecs(options);
+            case CommandLineAction::benchmarkNetwork:
+                return benchmarkNetwork(options);
+            case CommandLineAction::benchmarkRouting:
+                return benchmarkRouting(options);
             case CommandLineAction::compare:
                 return compare(options);
             default:
@@ -578,6 +644,348 @@ namespace OpenLoco
         return 0;
     }
 
+    static int simulateBatch(const CommandLineOptions& options)
+    {
+        if (options.path.empty())
+        {
+            Logging::error("No directory or manifest of saves specified");
+            return 2;
+        }
+        if (!options.ticks)
+        {
+            Logging::error("Number of ticks to simulate not specified");
+            return 2;
+        }
+
+        SimulateBatch::Options batchOptions;
+        batchOptions.inputPath = fs::u8path(options.path);
+        batchOptions.ticks = *options.ticks;
+        batchOptions.jobs = std::max(options.jobs.value_or(0), 0);
+        batchOptions.reportPath = fs::u8path(options.outputPath);
+        return SimulateBatch::run(batchOptions);
+    }
+
+    // Shows how often each hot caller of the tile index avoided walking a tile
+    static void logTileIndexStatistics()
+    {
+        using World::TileManager::IndexQuery;
+        constexpr std::array<std::pair<IndexQuery, std::string_view>, World::TileManager::kNumIndexQueries> kQueries = {
+            std::pair{ IndexQuery::surface, "surface (getHeight)" },
+            std::pair{ IndexQuery::elementType, "element type (countSurroundingTrees)" },
+            std::pair{ IndexQuery::transportElements, "transport (getStationElement)" },
+        };
+
+        Logging::info("Tile index:                                  lookups        hits");
+        for (const auto& [query, name] : kQueries)
+        {
+            const auto statistics = World::TileManager::getIndexStatistics(query);
+            const auto hitRate = statistics.lookups != 0 ? statistics.hits * 100.0 / statistics.lookups : 0.0;
+            Logging::info("  {:<38} {:>11} {:>11} {:>6.2f}%", name, statistics.lookups, statistics.hits, hitRate);
+        }
+    }
+
+    static int benchmark(const CommandLineOptions& options)
+    {
+        if (!options.ticks)
+        {
+            Logging::error("Number of ticks to benchmark not specified");
+            return 2;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        auto outPath = fs::u8path(options.outputPath);
+
+        World::TileManager::setIndexEnabled(options.tileIndex);
+        World::TileManager::resetIndexStatistics();
+        Benchmark::reset();
+        try
+        {
+            Benchmark::ScopedEnable enableBenchmark;
+            OpenLoco::simulateGame(inPath, *options.ticks);
+        }
+        catch (...)
+        {
+            Logging::error("Unable to load and benchmark {}", inPath.u8string());
+            return 2;
+        }
+
+        const auto results = Benchmark::getResults();
+
+        auto& gameState = getGameState();
+        Logging::info("--------------------------------");
+        Logging::info("- Benchmark");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path: {}", inPath.u8string());
+        Logging::info("  ticks: {} ticks", *options.ticks);
+        Logging::info("Output:");
+        Logging::info("  scenario ticks: {}", gameState.scenarioTicks);
+        Logging::info("  rng:            {{ {}, {} }}", gameState.rng.srand_0(), gameState.rng.srand_1());
+        Benchmark::logResults(results);
+        if (options.tileIndex)
+        {
+            logTileIndexStatistics();
+        }
+
+        if (!outPath.empty())
+        {
+            try
+            {
+                Benchmark::writeResultsJson(outPath, inPath, results);
+                Logging::info("Results written to {}", outPath.u8string());
+            }
+            catch (...)
+            {
+                Logging::error("Unable to write benchmark results to {}", outPath.u8string());
+                return 2;
+            }
+        }
+
+        return 0;
+    }
+
+    struct CodecTimings
+    {
+        uint32_t numChunks{};
+        size_t decodedBytes{};
+        std::chrono::nanoseconds decodeTime{};
+        std::chrono::nanoseconds encodeTime{};
+    };
+
+    // Measures the throughput of the Sawyer chunk codecs on the chunks of an S5 file
+    static int benchmarkCodecs(const CommandLineOptions& options)
+    {
+        using namespace S5;
+        using ClockType = std::chrono::high_resolution_clock;
+
+        if (options.path.empty())
+        {
+            Logging::error("No file specified.");
+            return 2;
+        }
+        const auto iterations = std::max(options.iterations.value_or(10), 1);
+
+        try
+        {
+            auto path = fs::u8path(options.path);
+
+            MemoryStream ms;
+            {
+                FileStream fsInput(path, StreamMode::read);
+                ms.resize(fsInput.getLength());
+                fsInput.read(ms.data(), fsInput.getLength());
+            }
+            SawyerStreamReader reader(ms);
+
+            // Copy out each encoded chunk (encoding, length and data) so they can be decoded repeatedly
+            MemoryStream encodedChunks;
+            std::vector<std::pair<SawyerEncoding, std::vector<std::byte>>> decodedChunks;
+            const auto readChunk = [&]() {
+                const auto position = ms.getPosition();
+                const auto chunk = reader.readChunk();
+                encodedChunks.write(ms.data() + position, ms.getPosition() - position);
+                decodedChunks.emplace_back(static_cast<SawyerEncoding>(ms.data()[position]), std::vector<std::byte>(chunk.begin(), chunk.end()));
+                return chunk;
+            };
+
+            Header header;
+            const auto headerChunk = readChunk();
+            std::memcpy(&header, headerChunk.data(), std::min(headerChunk.size(), sizeof(header)));
+            if (header.hasFlags(HeaderFlags::hasSaveDetails))
+            {
+                readChunk();
+            }
+            for (auto i = 0; i < header.numPackedObjects; i++)
+            {
+                ObjectHeader object;
+                reader.read(&object, sizeof(ObjectHeader));
+                readChunk();
+            }
+            if (header.type != S5Type::objects)
+            {
+                // Required objects, game state and tile elements chunks
+                readChunk();
+                readChunk();
+                readChunk();
+            }
+
+            std::array<CodecTimings, 4> timings{};
+            bool roundTripIdentical = true;
+            for (auto iteration = 0; iteration < iterations; iteration++)
+            {
+                encodedChunks.setPosition(0);
+                SawyerStreamReader chunkReader(encodedChunks);
+                for (const auto& [encoding, data] : decodedChunks)
+                {
+                    const auto start = ClockType::now();
+                    chunkReader.readChunk();
+                    timings[enumValue(encoding)].decodeTime += ClockType::now() - start;
+                }
+
+                MemoryStream output;
+                SawyerStreamWriter writer(output);
+                for (const auto& [encoding, data] : decodedChunks)
+                {
+                    const auto start = ClockType::now();
+                    writer.writeChunk(encoding, data.data(), data.size());
+                    timings[enumValue(encoding)].encodeTime += ClockType::now() - start;
+                }
+                roundTripIdentical &= output.getLength() == encodedChunks.getLength() && std::memcmp(output.data(), encodedChunks.data(), output.getLength()) == 0;
+            }
+            for (const auto& [encoding, data] : decodedChunks)
+            {
+                timings[enumValue(encoding)].numChunks++;
+                timings[enumValue(encoding)].decodedBytes += data.size() * iterations;
+            }
+
+            const auto checksumStart = ClockType::now();
+            for (auto iteration = 0; iteration < iterations; iteration++)
+            {
+                reader.validateChecksum();
+            }
+            const auto checksumTime = ClockType::now() - checksumStart;
+
+            const auto toMBPerSecond = [](size_t bytes, std::chrono::nanoseconds duration) {
+                const auto seconds = std::chrono::duration<double>(duration).count();
+                return seconds > 0.0 ? bytes / (1024.0 * 1024.0) / seconds : 0.0;
+            };
+
+            constexpr std::array<std::string_view, 4> kEncodingNames = { "uncompressed", "runLengthSingle", "runLengthMulti", "rotate" };
+            Logging::info("--------------------------------");
+            Logging::info("- Benchmark codecs");
+            Logging::info("--------------------------------");
+            Logging::info("Input:");
+            Logging::info("  path:       {}", path.u8string());
+            Logging::info("  iterations: {}", iterations);
+            Logging::info("Encoding:            chunks   decoded MB  decode MB/s  encode MB/s");
+            for (size_t i = 0; i < timings.size(); i++)
+            {
+                const auto& timing = timings[i];
+                if (timing.numChunks == 0)
+                {
+                    continue;
+                }
+                Logging::info("  {:<16} {:>8} {:>12.2f} {:>12.1f} {:>12.1f}", kEncodingNames[i], timing.numChunks, timing.decodedBytes / (1024.0 * 1024.0), toMBPerSecond(timing.decodedBytes, timing.decodeTime), toMBPerSecond(timing.decodedBytes, timing.encodeTime));
+            }
+            Logging::info("  checksum MB/s:  {:.1f}", toMBPerSecond(ms.getLength() * iterations, checksumTime));
+            Logging::info("  re-encoded identical: {}", roundTripIdentical ? "yes" : "no");
+
+            return 0;
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to benchmark S5 file: {}", e.what());
+            return 2;
+        }
+    }
+
+    // Measures state transfer time and game command latency over a simulated lossy link
+    static int benchmarkNetwork(const CommandLineOptions& options)
+    {
+        Network::LoopbackBenchmark::Options benchmarkOptions;
+        benchmarkOptions.packetLoss = static_cast<uint32_t>(std::clamp(options.packetLoss.value_or(0), 0, 99));
+
+        const auto results = Network::LoopbackBenchmark::run(benchmarkOptions);
+
+        Logging::info("--------------------------------");
+        Logging::info("- Benchmark network");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  packet loss: {}%", benchmarkOptions.packetLoss);
+        Logging::info("  latency:     {} ms", benchmarkOptions.latency);
+        Logging::info("  bandwidth:   {} KiB/s", benchmarkOptions.bandwidth * 1000 / 1024);
+        Logging::info("  state size:  {} KiB", benchmarkOptions.stateSize / 1024);
+        Logging::info("Output:");
+        if (results.stateTransferComplete)
+        {
+            Logging::info("  state transfer:     {} ms", results.stateTransferTime);
+        }
+        else
+        {
+            Logging::info("  state transfer:     incomplete after {} ms", results.stateTransferTime);
+        }
+        Logging::info("  game commands:      {} / {}", results.gameCommandsReceived, benchmarkOptions.numGameCommands);
+        Logging::info("  command latency:    mean {:.1f} ms, p99 {} ms, max {} ms", results.gameCommandLatencyMean, results.gameCommandLatencyP99, results.gameCommandLatencyMax);
+        Logging::info("  datagrams dropped:  {}", results.datagramsDropped);
+        Logging::info("  server sent:        {} packets, {} resent, {} acks", results.server.packetsSent, results.server.packetsResent, results.server.acksSent);
+        Logging::info("  client sent:        {} packets, {} resent, {} acks", results.client.packetsSent, results.client.packetsResent, results.client.acksSent);
+        Logging::info("  server window:      {} packets, round trip {} ms", results.server.window, results.server.roundTripTime);
+
+        return results.stateTransferComplete && results.gameCommandsReceived == benchmarkOptions.numGameCommands ? 0 : 2;
+    }
+
+    // Measures the set used by track network searches on synthetic networks, reusing one map across
+    // searches as the game does and constructing a fresh map for every search for comparison
+    static int benchmarkRouting(const CommandLineOptions& options)
+    {
+        using ClockType = std::chrono::high_resolution_clock;
+        using Vehicles::LocationOfInterest;
+        using Vehicles::LocationOfInterestHashMap;
+
+        const auto iterations = std::max(options.iterations.value_or(100), 1);
+
+        Logging::info("--------------------------------");
+        Logging::info("- Benchmark routing");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  iterations: {}", iterations);
+        Logging::info("Track pieces:    reused ms/search  reused ns/add   fresh ms/search  fresh ns/add");
+
+        bool allAdded = true;
+        LocationOfInterestHashMap reusedMap;
+        for (const auto numPieces : { 1000, 10000, 50000 })
+        {
+            // Track laid row by row across the map, each piece reached from both of its ends
+            std::vector<LocationOfInterest> network;
+            network.reserve(numPieces * 2);
+            for (auto i = 0; i < numPieces; i++)
+            {
+                const auto tile = i % World::kMapSize;
+                const auto loc = World::Pos3(tile % World::kMapColumns * World::kTileSize, tile / World::kMapColumns * World::kTileSize, 32);
+                const auto trackId = static_cast<uint16_t>(i % 3);
+                network.push_back(LocationOfInterest{ loc, static_cast<uint16_t>(trackId << 3), CompanyId(0), 0 });
+                network.push_back(LocationOfInterest{ loc, static_cast<uint16_t>((trackId << 3) | (1 << 2)), CompanyId(0), 0 });
+            }
+
+            // Searches find most track more than once so every piece is offered twice
+            const auto search = [&network](LocationOfInterestHashMap& map) {
+                size_t added = 0;
+                for (const auto& interest : network)
+                {
+                    added += map.tryAdd(interest);
+                    added += map.tryAdd(interest);
+                }
+                return added;
+            };
+
+            const auto reusedStart = ClockType::now();
+            for (auto iteration = 0; iteration < iterations; iteration++)
+            {
+                reusedMap.clear();
+                allAdded &= search(reusedMap) == network.size();
+            }
+            const auto reusedTime = std::chrono::duration<double, std::milli>(ClockType::now() - reusedStart).count();
+
+            const auto freshStart = ClockType::now();
+            for (auto iteration = 0; iteration < iterations; iteration++)
+            {
+                LocationOfInterestHashMap freshMap;
+                allAdded &= search(freshMap) == network.size();
+            }
+            const auto freshTime = std::chrono::duration<double, std::milli>(ClockType::now() - freshStart).count();
+
+            const auto numAdds = static_cast<double>(network.size()) * 2 * iterations;
+            Logging::info("  {:>10} {:>18.3f} {:>14.1f} {:>17.3f} {:>13.1f}", numPieces, reusedTime / iterations, reusedTime * 1'000'000 / numAdds, freshTime / iterations, freshTime * 1'000'000 / numAdds);
+        }
+
+        if (!allAdded)
+        {
+            Logging::error("Track network search did not find every piece of track");
+            return 2;
+        }
+        return 0;
+    }
+
     static int compare(const CommandLineOptions& options)
     {
         auto file1 = fs::u8path(options.path);
@@ -594,7 +1002,7 @@ namespace OpenLoco
 
         try
         {
-            if (OpenLoco::GameSaveCompare::compareGameStates(file1, file2, displayAllDivergences))
+            if (OpenLoco::GameSaveCompare::compareGameStates(file1, file2, displayAllDivergences, options.summaryOnly))
             {
                 Logging::info("MATCHES", file1, file2);
             }
@@ -14,6 +14,11 @@ namespace OpenLoco
         join,
         uncompress,
         simulate,
+        simulateBatch,
+        benchmark,
+        benchmarkCodecs,
+        benchmarkNetwork,
+        benchmarkRouting,
         compare,
         help,
         version,
@@ -27,11 +32,16 @@ namespace OpenLoco
         std::string path;
         std::string path2;
         std::optional<int32_t> ticks;
+        std::optional<int32_t> iterations;
+        std::optional<int32_t> jobs;
+        std::optional<int32_t> packetLoss;
         std::string outputPath;
         std::string bind;
         std::optional<uint16_t> port{};
         std::string logLevels;
         std::string all;
+        bool tileIndex = false;
+        bool summaryOnly = false;
     };
 
     std::optional<CommandLineOptions> parseCommandLine(std::vector<std::string>&& argv);
@@ -257,6 +257,9 @@ namespace OpenLoco::Config
         _newConfig.scaleFactor = config["scale_factor"].as<float>(1.0f);
         _newConfig.showFPS = config["showFPS"].as<bool>(false);
         _newConfig.uncapFPS = config["uncapFPS"].as<bool>(false);
+        _newConfig.multiThreadedRendering = config["multiThreadedRendering"].as<bool>(false);
+        _newConfig.tileElementIndex = config["tileElementIndex"].as<bool>(false);
+        _newConfig.memoryMappedG1 = config["memoryMappedG1"].as<bool>(false);
 
         // General UI
         _newConfig.allowMultipleInstances = config["allow_multiple_instances"].as<bool>(false);
@@ -357,6 +360,9 @@ namespace OpenLoco::Config
         node["scale_factor"] = _newConfig.scaleFactor;
         node["showFPS"] = _newConfig.showFPS;
         node["uncapFPS"] = _newConfig.uncapFPS;
+        node["multiThreadedRendering"] = _newConfig.multiThreadedRendering;
+        node["tileElementIndex"] = _newConfig.tileElementIndex;
+        node["memoryMappedG1"] = _newConfig.memoryMappedG1;
 
         // General UI
         node["allow_multiple_instances"] = _newConfig.allowMultipleInstances;
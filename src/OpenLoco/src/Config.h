@@ -178,6 +178,9 @@ namespace OpenLoco::Config
         float scaleFactor = 1.0f;
         bool showFPS = false;
         bool uncapFPS = false;
+        bool multiThreadedRendering = false;
+        bool tileElementIndex = false;
+        bool memoryMappedG1 = false;
 
         bool allowMultipleInstances = false;
         bool cashPopupRendering = true;
@@ -59,6 +59,6 @@ namespace OpenLoco::Drawing
         drawingCtx.drawString(rt, x, y, Colour::black, buffer);
 
         // Make area dirty so the text doesn't get drawn over the last
-        Gfx::invalidateRegion(x - 16, y - 4, x + 16, 16);
+        Gfx::invalidateRegion(x - 16, y - 4, x + stringWidth + 16, 16);
     }
 }
@@ -10,6 +10,7 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <SDL2/SDL.h>
 #include <algorithm>
+#include <mutex>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Gfx;
@@ -729,6 +730,11 @@ namespace OpenLoco::Drawing
         // 0x00450705
         static void drawImageMasked(Gfx::RenderTarget& rt, const Ui::Point& pos, const ImageId& image, const ImageId& maskImage)
         {
+            // The original routine uses fixed scratch memory so callers from paint worker threads must be serialised.
+            // Kept until a native version has been checked against it pixel for pixel.
+            static std::mutex maskedImageMutex;
+            std::scoped_lock lock(maskedImageMutex);
+
             registers regs;
             regs.edi = X86Pointer(&rt);
             regs.cx = pos.x;
@@ -163,6 +163,9 @@ namespace OpenLoco::Drawing
         uint32_t format;
         SDL_QueryTexture(_screenTexture, &format, nullptr, nullptr, nullptr);
         _screenTextureFormat = SDL_AllocFormat(format);
+        _directPresent = _screenTextureFormat->BytesPerPixel == 2 || _screenTextureFormat->BytesPerPixel == 4;
+        updatePaletteTexels(0, 256);
+        _presentAll = true;
 
         int32_t pitch = _screenSurface->pitch;
 
@@ -202,6 +205,13 @@ namespace OpenLoco::Drawing
     void SoftwareDrawingEngine::invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
     {
         _invalidationGrid.invalidate(left, top, right, bottom);
+        // Also covers anything drawn straight to the screen before invalidating it
+        addPresentRegion(left, top, right, bottom);
+    }
+
+    void SoftwareDrawingEngine::invalidatePresent()
+    {
+        _presentAll = true;
     }
 
     // Helper function until all users of set_palette_callback are implemented
@@ -232,6 +242,44 @@ namespace OpenLoco::Drawing
             basePtr->a = 0;
         }
         SDL_SetPaletteColors(_palette, &base[index], index, count);
+
+        std::copy_n(&entries[index], count, &_paletteColours[index]);
+        updatePaletteTexels(index, count);
+        // Every pixel using the changed colours needs presenting again
+        _presentAll = true;
+    }
+
+    void SoftwareDrawingEngine::updatePaletteTexels(int32_t index, int32_t count)
+    {
+        if (_screenTextureFormat == nullptr)
+        {
+            return;
+        }
+        for (auto i = index; i < index + count; ++i)
+        {
+            const auto& colour = _paletteColours[i];
+            _paletteTexels[i] = SDL_MapRGB(_screenTextureFormat, colour.r, colour.g, colour.b);
+        }
+    }
+
+    void SoftwareDrawingEngine::addPresentRegion(int32_t left, int32_t top, int32_t right, int32_t bottom)
+    {
+        if (left >= right || top >= bottom)
+        {
+            return;
+        }
+        if (_presentLeft >= _presentRight)
+        {
+            _presentLeft = left;
+            _presentTop = top;
+            _presentRight = right;
+            _presentBottom = bottom;
+            return;
+        }
+        _presentLeft = std::min(_presentLeft, left);
+        _presentTop = std::min(_presentTop, top);
+        _presentRight = std::max(_presentRight, right);
+        _presentBottom = std::max(_presentBottom, bottom);
     }
 
     // 0x004C5CFA
@@ -263,20 +311,98 @@ namespace OpenLoco::Drawing
         rt.pitch = _screenRT->width + _screenRT->pitch - rect.width();
         rt.zoomLevel = 0;
 
+        addPresentRegion(rect.left(), rect.top(), rect.right(), rect.bottom());
+
         // TODO: Remove main window and draw that independent from UI.
 
         // Draw UI.
         Ui::WindowManager::render(rt, rect);
     }
 
-    void SoftwareDrawingEngine::present()
+    template<typename T>
+    static void convertPixels(const uint8_t* src, int32_t srcPitch, uint8_t* dst, int32_t dstPitch, int32_t width, int32_t height, const std::array<uint32_t, 256>& texels)
+    {
+        for (auto y = 0; y < height; ++y, src += srcPitch, dst += dstPitch)
+        {
+            auto* dstRow = reinterpret_cast<T*>(dst);
+            auto x = 0;
+            // There is no byte gather before AVX2 so the lookup is unrolled instead
+            for (; x + 4 <= width; x += 4)
+            {
+                dstRow[x + 0] = static_cast<T>(texels[src[x + 0]]);
+                dstRow[x + 1] = static_cast<T>(texels[src[x + 1]]);
+                dstRow[x + 2] = static_cast<T>(texels[src[x + 2]]);
+                dstRow[x + 3] = static_cast<T>(texels[src[x + 3]]);
+            }
+            for (; x < width; ++x)
+            {
+                dstRow[x] = static_cast<T>(texels[src[x]]);
+            }
+        }
+    }
+
+    // Converts the regions rendered since the last present straight from the screen buffer into the texture
+    bool SoftwareDrawingEngine::presentDirect()
+    {
+        auto& rt = Gfx::getScreenRT();
+        if (rt.bits == nullptr)
+        {
+            return false;
+        }
+
+        const auto screenWidth = _screenSurface->w;
+        const auto screenHeight = _screenSurface->h;
+        if (_presentAll)
+        {
+            _presentLeft = 0;
+            _presentTop = 0;
+            _presentRight = screenWidth;
+            _presentBottom = screenHeight;
+        }
+        const auto left = std::max(_presentLeft, 0);
+        const auto top = std::max(_presentTop, 0);
+        const auto right = std::min(_presentRight, screenWidth);
+        const auto bottom = std::min(_presentBottom, screenHeight);
+        if (left >= right || top >= bottom)
+        {
+            // Nothing has changed, the texture still holds the last frame
+            return true;
+        }
+
+        // The locked pixels are write only so only the changed region is locked
+        const SDL_Rect region{ left, top, right - left, bottom - top };
+        void* pixels;
+        int pitch;
+        if (SDL_LockTexture(_screenTexture, &region, &pixels, &pitch) < 0)
+        {
+            Logging::error("SDL_LockTexture {}", SDL_GetError());
+            return false;
+        }
+
+        const auto srcPitch = rt.width + rt.pitch;
+        const auto* src = rt.bits + left + top * srcPitch;
+        auto* dst = static_cast<uint8_t*>(pixels);
+        if (_screenTextureFormat->BytesPerPixel == 4)
+        {
+            convertPixels<uint32_t>(src, srcPitch, dst, pitch, region.w, region.h, _paletteTexels);
+        }
+        else
+        {
+            convertPixels<uint16_t>(src, srcPitch, dst, pitch, region.w, region.h, _paletteTexels);
+        }
+        SDL_UnlockTexture(_screenTexture);
+        return true;
+    }
+
+    // Whole frame conversion through SDL for texture formats without a direct palette lookup
+    bool SoftwareDrawingEngine::presentConverted()
     {
         // Lock the surface before setting its pixels
         if (SDL_MUSTLOCK(_screenSurface))
         {
             if (SDL_LockSurface(_screenSurface) < 0)
             {
-                return;
+                return false;
             }
         }
 
@@ -297,7 +423,7 @@ namespace OpenLoco::Drawing
         if (SDL_BlitSurface(_screenSurface, nullptr, _screenRGBASurface, nullptr))
         {
             Logging::error("SDL_BlitSurface {}", SDL_GetError());
-            return;
+            return false;
         }
 
         // Stream the RGBA pixels into screen texture.
@@ -306,6 +432,18 @@ namespace OpenLoco::Drawing
         SDL_LockTexture(_screenTexture, NULL, &pixels, &pitch);
         SDL_ConvertPixels(_screenRGBASurface->w, _screenRGBASurface->h, _screenRGBASurface->format->format, _screenRGBASurface->pixels, _screenRGBASurface->pitch, _screenTextureFormat->format, pixels, pitch);
         SDL_UnlockTexture(_screenTexture);
+        return true;
+    }
+
+    void SoftwareDrawingEngine::present()
+    {
+        const auto presented = _directPresent ? presentDirect() : presentConverted();
+        if (!presented)
+        {
+            return;
+        }
+        _presentAll = false;
+        _presentLeft = _presentTop = _presentRight = _presentBottom = 0;
 
         if (Config::get().scaleFactor > 1.0f)
         {
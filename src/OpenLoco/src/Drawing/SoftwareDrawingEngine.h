@@ -5,6 +5,7 @@
 #include "SoftwareDrawingContext.h"
 #include <OpenLoco/Engine/Ui/Rect.hpp>
 #include <algorithm>
+#include <array>
 #include <cstddef>
 
 struct SDL_Palette;
@@ -49,6 +50,10 @@ namespace OpenLoco::Drawing
         // Invalidates a region, this forces it to be rendered next frame.
         void invalidateRegion(int32_t left, int32_t top, int32_t right, int32_t bottom);
 
+        // Only regions rendered since the last present are normally presented, this presents the whole
+        // screen next time for anything that draws to the screen without rendering.
+        void invalidatePresent();
+
         void createPalette();
         SDL_Palette* getPalette() { return _palette; }
         void updatePalette(const PaletteEntry* entries, int32_t index, int32_t count);
@@ -68,6 +73,23 @@ namespace OpenLoco::Drawing
 
         SDL_Texture* _screenRGBATexture{};
 
+        // Palette in the pixel format of the screen texture, only used for 16 and 32 bit formats
+        std::array<PaletteEntry, 256> _paletteColours{};
+        std::array<uint32_t, 256> _paletteTexels{};
+        bool _directPresent{};
+
+        // Bounds of the regions rendered since the last present
+        int32_t _presentLeft{};
+        int32_t _presentTop{};
+        int32_t _presentRight{};
+        int32_t _presentBottom{};
+        bool _presentAll = true;
+
+        void updatePaletteTexels(int32_t index, int32_t count);
+        void addPresentRegion(int32_t left, int32_t top, int32_t right, int32_t bottom);
+        bool presentDirect();
+        bool presentConverted();
+
         SoftwareDrawingContext _ctx;
         InvalidationGrid _invalidationGrid;
     };
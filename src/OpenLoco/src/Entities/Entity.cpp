@@ -15,13 +15,9 @@ bool EntityBase::empty() const
     return baseType == EntityBaseType::null;
 }
 
-// 0x0046FC83
-void EntityBase::moveTo(const World::Pos3& loc)
+void EntityBase::setSpriteBounds(const World::Pos3& loc)
 {
-    EntityManager::moveSpatialEntry(*this, loc);
-
-    // Update sprite boundaries
-    if (position.x == Location::null)
+    if (loc.x == Location::null)
     {
         spriteLeft = Location::null;
         return;
@@ -34,6 +30,13 @@ void EntityBase::moveTo(const World::Pos3& loc)
     spriteBottom = vpPos.y + spriteHeightPositive;
 }
 
+// 0x0046FC83
+void EntityBase::moveTo(const World::Pos3& loc)
+{
+    EntityManager::moveSpatialEntry(*this, loc);
+    setSpriteBounds(loc);
+}
+
 // 0x004CBB01
 void OpenLoco::EntityBase::invalidateSprite()
 {
@@ -76,6 +76,8 @@ namespace OpenLoco
         StringId name;                // 0x22, combined with ordinalNumber on vehicles
 
         void moveTo(const World::Pos3& loc);
+        // Places the sprite bounds as if the entity was at loc without moving it, moveTo places them back at the position
+        void setSpriteBounds(const World::Pos3& loc);
         void invalidateSprite();
 
         template<typename T>
@@ -1,4 +1,5 @@
 #include "EntityTweener.h"
+#include "Engine/Limits.h"
 #include "Entity.h"
 #include "OpenLoco.h"
 #include "Vehicles/Vehicle.h"
@@ -26,6 +27,11 @@ namespace OpenLoco
 
     static EntityTweener _tweener;
 
+    EntityTweener::EntityTweener()
+        : _entitySlots(Limits::kMaxEntities)
+    {
+    }
+
     EntityTweener& EntityTweener::get()
     {
         return _tweener;
@@ -45,10 +51,16 @@ namespace OpenLoco
             }
             return vehicle->isVehicleBody() || vehicle->isVehicleBogie();
         });
+
+        for (size_t i = 0; i < _entities.size(); ++i)
+        {
+            _entitySlots[enumValue(_entities[i]->id)] = static_cast<uint32_t>(i);
+        }
     }
 
     void EntityTweener::postTick()
     {
+        _postPos.reserve(_entities.size());
         for (auto* ent : _entities)
         {
             if (ent == nullptr || ent->id == EntityId::null)
@@ -61,15 +73,43 @@ namespace OpenLoco
                 _postPos.emplace_back(ent->position);
             }
         }
+        _renderPos = _postPos;
+    }
+
+    size_t EntityTweener::findSlot(const EntityBase& entity) const
+    {
+        const auto id = enumValue(entity.id);
+        if (id >= _entitySlots.size())
+        {
+            return _entities.size();
+        }
+
+        // Slots left over from previous ticks are ignored as they no longer point back at the entity
+        const auto slot = _entitySlots[id];
+        if (slot < _entities.size() && _entities[slot] == &entity)
+        {
+            return slot;
+        }
+        return _entities.size();
     }
 
     void EntityTweener::removeEntity(const EntityBase* entity)
     {
-        auto it = std::find(_entities.begin(), _entities.end(), entity);
-        if (it != _entities.end())
+        const auto slot = findSlot(*entity);
+        if (slot < _entities.size())
+        {
+            _entities[slot] = nullptr;
+        }
+    }
+
+    World::Pos3 EntityTweener::getRenderPosition(const EntityBase& entity) const
+    {
+        const auto slot = findSlot(entity);
+        if (slot < _renderPos.size())
         {
-            *it = nullptr;
+            return _renderPos[slot];
         }
+        return entity.position;
     }
 
     void EntityTweener::tween(float alpha)
@@ -85,17 +125,18 @@ namespace OpenLoco
             auto& posA = _prePos[i];
             auto& posB = _postPos[i];
 
-            if (posA == posB)
+            if (posA == posB || posA.x == Location::null || posB.x == Location::null)
                 continue;
 
             auto newPos = World::Pos3{ static_cast<int16_t>(std::round(posB.x * alpha + posA.x * inv)),
                                        static_cast<int16_t>(std::round(posB.y * alpha + posA.y * inv)),
                                        static_cast<int16_t>(std::round(posB.z * alpha + posA.z * inv)) };
 
-            if (ent->position == newPos)
+            if (_renderPos[i] == newPos)
                 continue;
 
-            ent->moveTo(newPos);
+            _renderPos[i] = newPos;
+            ent->setSpriteBounds(newPos);
             ent->invalidateSprite();
         }
     }
@@ -110,19 +151,22 @@ namespace OpenLoco
 
             auto& newPos = _postPos[i];
 
-            if (ent->position == newPos)
+            if (_renderPos[i] == newPos)
                 continue;
 
-            ent->moveTo(newPos);
+            _renderPos[i] = newPos;
+            ent->setSpriteBounds(newPos);
             ent->invalidateSprite();
         }
     }
 
+    // Storage is kept for the next tick
     void EntityTweener::reset()
     {
         _entities.clear();
         _prePos.clear();
         _postPos.clear();
+        _renderPos.clear();
     }
 
 }
@@ -6,18 +6,28 @@
 
 namespace OpenLoco
 {
+    // Draws moving entities between their positions of the last two ticks. Only where the entities are drawn
+    // changes, their positions and the spatial index always hold the simulated state.
     class EntityTweener
     {
         std::vector<EntityBase*> _entities;
         std::vector<World::Pos3> _prePos;
         std::vector<World::Pos3> _postPos;
+        std::vector<World::Pos3> _renderPos;
+        std::vector<uint32_t> _entitySlots; // Index into _entities by entity id, only valid if it points back at the entity
+
+        size_t findSlot(const EntityBase& entity) const;
 
     public:
+        EntityTweener();
+
         static EntityTweener& get();
 
         void preTick();
         void postTick();
         void removeEntity(const EntityBase* entity);
+        // Where the entity is drawn, which is its position unless it is being tweened
+        World::Pos3 getRenderPosition(const EntityBase& entity) const;
         void tween(float alpha);
         void restore();
         void reset();
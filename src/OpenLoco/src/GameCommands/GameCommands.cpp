@@ -347,6 +347,9 @@ namespace OpenLoco::GameCommands
             auto addr = gameCommand.originalAddress;
             call(addr, regs);
         }
+        // Commands may have changed tile elements in place or written the catchment map through vanilla code
+        World::TileManager::invalidateIndex();
+        invalidateCatchmentBounds();
     }
 
     static uint32_t loc_4313C6(int esi, const registers& regs)
@@ -400,6 +403,9 @@ namespace OpenLoco::GameCommands
             return ebx;
         }
 
+        // Any command may modify track, cached track connectivity is not used until the outermost command returns
+        Vehicles::invalidateTrackNetworkCache();
+
         uint16_t flagsBackup2 = _gameCommandFlags;
         registers fnRegs2 = regs;
         callGameCommandFunction(esi, fnRegs2);
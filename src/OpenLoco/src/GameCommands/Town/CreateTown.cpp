@@ -31,6 +31,8 @@ namespace OpenLoco::GameCommands
         regs.eax = pos.x;
         regs.ecx = pos.y;
         call(0x00496FE7, regs);
+        // The town is allocated by the original code
+        TownManager::rebuildOccupancy();
 
         if (regs.esi != -1)
             return reinterpret_cast<Town*>(regs.esi);
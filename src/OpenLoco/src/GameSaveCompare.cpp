@@ -1,5 +1,11 @@
 #include "GameSaveCompare.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <future>
+#include <optional>
 #include <string>
 
 #include "Effects/EffectsManager.h"
@@ -20,7 +26,9 @@ namespace OpenLoco::GameSaveCompare
     void logVehicleTypeAndSubType(int offset, const OpenLoco::Entity& entity);
     void logEffectType(int offset, const OpenLoco::Entity& entity);
     long logDivergentEntityOffset(const S5::Entity& lhs, const S5::Entity& rhs, int offset, bool displayAllDivergences, long divergentBytesTotal);
-    bool compareGameStates(S5::GameState& gameState1, S5::GameState& gameState2, bool displayAllDivergences);
+    struct DivergentRegions;
+    bool compareGameStates(S5::GameState& gameState1, S5::GameState& gameState2, bool displayAllDivergences, const DivergentRegions& divergentRegions);
+    static bool compareGeneralFields(S5::GameState& gameState1, S5::GameState& gameState2, bool displayAllDivergences);
     bool isLoggedDivergenceRoutings(OpenLoco::S5::GameState& gameState1, OpenLoco::S5::GameState& gameState2, bool displayAllDivergences);
     bool compareElements(const std::vector<S5::TileElement>& tileElements1, const std::vector<S5::TileElement>& tileElements2, bool displayAllDivergences);
 
@@ -48,6 +56,142 @@ namespace OpenLoco::GameSaveCompare
         return std::equal(bytesSpanLhs.begin(), bytesSpanLhs.end(), bytesSpanRhs.begin(), bytesSpanRhs.end());
     }
 
+    // Parts of the game state compared as raw memory before any per field diagnostics are produced
+    struct GameStateRegion
+    {
+        std::string_view name;
+        size_t offset;
+        size_t size;
+    };
+
+#define GAME_STATE_REGION(name, field) GameStateRegion{ name, offsetof(S5::GameState, field), sizeof(S5::GameState::field) }
+    static constexpr std::array kGameStateRegions = {
+        GameStateRegion{ "general", 0, offsetof(S5::GameState, companies) },
+        GAME_STATE_REGION("companies", companies),
+        GAME_STATE_REGION("towns", towns),
+        GAME_STATE_REGION("industries", industries),
+        GAME_STATE_REGION("stations", stations),
+        GAME_STATE_REGION("entities", entities),
+        GAME_STATE_REGION("animations", animations),
+        GAME_STATE_REGION("waves", waves),
+        GAME_STATE_REGION("userStrings", userStrings),
+        GAME_STATE_REGION("routings", routings),
+        GAME_STATE_REGION("orders", orders),
+    };
+#undef GAME_STATE_REGION
+    static constexpr size_t kTileElementsRegion = kGameStateRegions.size();
+    static constexpr size_t kNumRegions = kGameStateRegions.size() + 1;
+
+    // Memory is compared in large chunks and a differing chunk is narrowed down to its first differing block
+    static constexpr size_t kCompareChunkSize = 0x10000;
+    static constexpr size_t kCompareBlockSize = 64;
+
+    struct DivergentRegions
+    {
+        // Offset of the first differing block in each region
+        std::array<std::optional<size_t>, kNumRegions> firstBlock;
+
+        bool any() const
+        {
+            return std::any_of(firstBlock.begin(), firstBlock.end(), [](const auto& block) { return block.has_value(); });
+        }
+
+        bool contains(size_t region) const
+        {
+            return firstBlock[region].has_value();
+        }
+    };
+
+    // Returns the offset of the first differing block, stops early once abort returns true
+    template<typename TAbort>
+    static std::optional<size_t> findFirstDivergentBlock(std::span<const std::byte> lhs, std::span<const std::byte> rhs, TAbort&& abort)
+    {
+        const auto size = std::min(lhs.size(), rhs.size());
+        for (size_t chunk = 0; chunk < size; chunk += kCompareChunkSize)
+        {
+            if (abort())
+            {
+                return std::nullopt;
+            }
+            const auto chunkSize = std::min(kCompareChunkSize, size - chunk);
+            if (std::memcmp(lhs.data() + chunk, rhs.data() + chunk, chunkSize) == 0)
+            {
+                continue;
+            }
+            for (auto block = chunk;; block += kCompareBlockSize)
+            {
+                const auto blockSize = std::min(kCompareBlockSize, size - block);
+                if (std::memcmp(lhs.data() + block, rhs.data() + block, blockSize) != 0)
+                {
+                    return block;
+                }
+            }
+        }
+        if (lhs.size() != rhs.size())
+        {
+            return size;
+        }
+        return std::nullopt;
+    }
+
+    // Compares every region on its own thread. With stopAtFirst regions after the first divergent one are abandoned.
+    static DivergentRegions findDivergentRegions(const S5::GameState& gameState1, const S5::GameState& gameState2, std::span<const S5::TileElement> tileElements1, std::span<const S5::TileElement> tileElements2, bool stopAtFirst)
+    {
+        std::atomic<size_t> firstDivergentRegion = kNumRegions;
+        const auto compareRegion = [&](size_t region, std::span<const std::byte> lhs, std::span<const std::byte> rhs) {
+            auto block = findFirstDivergentBlock(lhs, rhs, [&]() { return stopAtFirst && firstDivergentRegion.load() < region; });
+            if (block)
+            {
+                auto current = firstDivergentRegion.load();
+                while (region < current && !firstDivergentRegion.compare_exchange_weak(current, region))
+                {
+                }
+            }
+            return block;
+        };
+
+        const auto* bytes1 = reinterpret_cast<const std::byte*>(&gameState1);
+        const auto* bytes2 = reinterpret_cast<const std::byte*>(&gameState2);
+        std::array<std::future<std::optional<size_t>>, kNumRegions> results;
+        for (size_t i = 0; i < kGameStateRegions.size(); i++)
+        {
+            const auto& region = kGameStateRegions[i];
+            results[i] = std::async(std::launch::async, compareRegion, i, std::span(bytes1 + region.offset, region.size), std::span(bytes2 + region.offset, region.size));
+        }
+        results[kTileElementsRegion] = std::async(std::launch::async, compareRegion, kTileElementsRegion, std::as_bytes(tileElements1), std::as_bytes(tileElements2));
+
+        DivergentRegions divergentRegions;
+        for (size_t i = 0; i < kNumRegions; i++)
+        {
+            divergentRegions.firstBlock[i] = results[i].get();
+        }
+        if (stopAtFirst)
+        {
+            // Later regions may have found a difference before being abandoned
+            for (size_t i = firstDivergentRegion + 1; i < kNumRegions; i++)
+            {
+                divergentRegions.firstBlock[i].reset();
+            }
+        }
+        return divergentRegions;
+    }
+
+    static void logDivergenceSummary(const DivergentRegions& divergentRegions)
+    {
+        for (size_t i = 0; i < kNumRegions; i++)
+        {
+            if (!divergentRegions.contains(i))
+            {
+                continue;
+            }
+            const auto name = i == kTileElementsRegion ? std::string_view("tileElements") : kGameStateRegions[i].name;
+            Logging::info("DIVERGENCE");
+            Logging::info("TYPE: {}", name);
+            Logging::info("    OFFSET: {}", *divergentRegions.firstBlock[i]);
+            return;
+        }
+    }
+
     template<typename T1, typename T2>
     long bitWiseLogDivergence(const std::string type, const T1& lhs, const T2& rhs, bool displayAllDivergences, long divergentBytesTotal)
     {
@@ -85,6 +229,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (unsigned int offset = 0; offset < sizeof(lhs); offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = bitWiseLogDivergence(type + " [" + std::to_string(offset) + "]", lhs[offset], rhs[offset], displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 1)
@@ -100,6 +248,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (int offset = 0; offset < arraySize; offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = bitWiseLogDivergence(type + " [" + std::to_string(offset) + "]", lhs[offset], rhs[offset], displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 0)
@@ -115,6 +267,10 @@ namespace OpenLoco::GameSaveCompare
         long divergentBytesTotal = 0;
         for (int offset = 0; offset < arraySize; offset++)
         {
+            if (bitWiseEqual(lhs[offset], rhs[offset]))
+            {
+                continue;
+            }
             divergentBytesTotal = bitWiseLogDivergence(type + " [" + std::to_string(offset) + "]", lhs[offset], rhs[offset], displayAllDivergences, divergentBytesTotal);
         }
         if (!displayAllDivergences && divergentBytesTotal > 1)
@@ -375,12 +531,72 @@ namespace OpenLoco::GameSaveCompare
         return divergentBytesTotal > 0;
     }
 
-    bool compareGameStates(S5::GameState& gameState1, S5::GameState& gameState2, bool displayAllDivergences)
+    static size_t regionIndex(std::string_view name)
+    {
+        auto it = std::find_if(kGameStateRegions.begin(), kGameStateRegions.end(), [name](const auto& region) { return region.name == name; });
+        return std::distance(kGameStateRegions.begin(), it);
+    }
+
+    bool compareGameStates(S5::GameState& gameState1, S5::GameState& gameState2, bool displayAllDivergences, const DivergentRegions& divergentRegions)
     {
         if (displayAllDivergences)
             Logging::info("display all divergences!");
 
         bool foundDivergence = false;
+        const auto differs = [&divergentRegions](std::string_view name) { return divergentRegions.contains(regionIndex(name)); };
+
+        // The field by field comparison is only needed when the block of fields preceding the companies differs
+        if (differs("general"))
+        {
+            foundDivergence |= compareGeneralFields(gameState1, gameState2, displayAllDivergences);
+        }
+        if (differs("companies"))
+        {
+            foundDivergence |= isLoggedDivergence("companies", gameState1.companies, gameState2.companies, S5::Limits::kMaxCompanies, displayAllDivergences);
+        }
+        if (differs("towns"))
+        {
+            foundDivergence |= isLoggedDivergence("towns", gameState1.towns, gameState2.towns, S5::Limits::kMaxTowns, displayAllDivergences);
+        }
+        if (differs("industries"))
+        {
+            foundDivergence |= isLoggedDivergence("industries", gameState1.industries, gameState2.industries, S5::Limits::kMaxIndustries, displayAllDivergences);
+        }
+        if (differs("stations"))
+        {
+            foundDivergence |= isLoggedDivergence("stations", gameState1.stations, gameState2.stations, S5::Limits::kMaxStations, displayAllDivergences);
+        }
+        if (differs("entities"))
+        {
+            foundDivergence |= logDivergentEntity(gameState1.entities, gameState2.entities, S5::Limits::kMaxEntities, displayAllDivergences);
+        }
+        if (differs("animations"))
+        {
+            foundDivergence |= isLoggedDivergence("animations", gameState1.animations, gameState2.animations, S5::Limits::kMaxAnimations, displayAllDivergences);
+        }
+        if (differs("waves"))
+        {
+            foundDivergence |= isLoggedDivergence("waves", gameState1.waves, gameState2.waves, S5::Limits::kMaxWaves, displayAllDivergences);
+        }
+        if (differs("userStrings"))
+        {
+            foundDivergence |= isLoggedDivergence("userStrings ", gameState1.userStrings, gameState2.userStrings, S5::Limits::kMaxUserStrings, displayAllDivergences);
+        }
+        if (differs("routings"))
+        {
+            foundDivergence |= isLoggedDivergenceRoutings(gameState1, gameState2, displayAllDivergences);
+        }
+        if (differs("orders"))
+        {
+            foundDivergence |= isLoggedDivergence("orders", gameState1.orders, gameState2.orders, S5::Limits::kMaxOrders, displayAllDivergences);
+        }
+
+        return not foundDivergence;
+    }
+
+    static bool compareGeneralFields(S5::GameState& gameState1, S5::GameState& gameState2, bool displayAllDivergences)
+    {
+        bool foundDivergence = false;
 
         foundDivergence |= isLoggedDivergence("rng", gameState1.rng, gameState2.rng, 2, displayAllDivergences);
         foundDivergence |= isLoggedDivergence("unkRng", gameState1.unkRng, gameState2.unkRng, 2, displayAllDivergences);
@@ -500,18 +716,8 @@ namespace OpenLoco::GameSaveCompare
         foundDivergence |= isLoggedDivergence("pad_B957", gameState1.pad_B957, gameState2.pad_B957, 0xB968 - 0xB957, displayAllDivergences);
         foundDivergence |= isLoggedDivergentGameStateField("currentRainLevel", 0, gameState1.currentRainLevel, gameState2.currentRainLevel);
         foundDivergence |= isLoggedDivergence("pad_B969", gameState1.pad_B969, gameState2.pad_B969, 0xB96C - 0xB969, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("companies", gameState1.companies, gameState2.companies, S5::Limits::kMaxCompanies, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("towns", gameState1.towns, gameState2.towns, S5::Limits::kMaxTowns, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("industries", gameState1.industries, gameState2.industries, S5::Limits::kMaxIndustries, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("stations", gameState1.stations, gameState2.stations, S5::Limits::kMaxStations, displayAllDivergences);
-        foundDivergence |= logDivergentEntity(gameState1.entities, gameState2.entities, S5::Limits::kMaxEntities, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("animations", gameState1.animations, gameState2.animations, S5::Limits::kMaxAnimations, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("waves", gameState1.waves, gameState2.waves, S5::Limits::kMaxWaves, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("userStrings ", gameState1.userStrings, gameState2.userStrings, S5::Limits::kMaxUserStrings, displayAllDivergences);
-        foundDivergence |= isLoggedDivergenceRoutings(gameState1, gameState2, displayAllDivergences);
-        foundDivergence |= isLoggedDivergence("orders", gameState1.orders, gameState2.orders, S5::Limits::kMaxOrders, displayAllDivergences);
 
-        return not foundDivergence;
+        return foundDivergence;
     }
 
     bool isLoggedDivergenceRoutings(OpenLoco::S5::GameState& gameState1, OpenLoco::S5::GameState& gameState2, bool displayAllDivergences)
@@ -550,39 +756,26 @@ namespace OpenLoco::GameSaveCompare
     bool compareElements(const std::vector<S5::TileElement>& tileElements1, const std::vector<S5::TileElement>& tileElements2, bool displayAllDivergences)
     {
         long divergentBytesTotal = 0;
-        std::vector<S5::TileElement> smaller = tileElements1;
-        std::vector<S5::TileElement> larger = tileElements2;
-        if (tileElements1.size() > tileElements2.size())
-        {
-            smaller = tileElements2;
-            larger = tileElements1;
-        }
-
         if (tileElements1.size() != tileElements2.size())
         {
             Logging::info("The TileElements sizes are different. Will compare up to the smallest TileElements size.");
             Logging::info("Size of TileElements1 = {}", tileElements1.size());
             Logging::info("Size of TileElements2 = {}", tileElements2.size());
         }
-        int elementCount = 0;
-        for (auto iterator1 = smaller.begin(), iterator2 = larger.begin(); iterator1 != smaller.end();
-             ++iterator1, ++iterator2)
+        const auto elementCount = std::min(tileElements1.size(), tileElements2.size());
+        for (size_t i = 0; i < elementCount; i++)
         {
-            if (iterator2 != larger.end())
-            {
-                S5::TileElement tile1 = tileElements1.at(elementCount);
-                S5::TileElement tile2 = tileElements2.at(elementCount);
+            const auto& tile1 = tileElements1[i];
+            const auto& tile2 = tileElements2[i];
 
-                if (!bitWiseEqual(tile1, tile2))
+            if (!bitWiseEqual(tile1, tile2))
+            {
+                if (divergentBytesTotal == 0)
                 {
-                    if (divergentBytesTotal == 0)
-                    {
-                        Logging::info("DIVERGENCE");
-                        Logging::info("TILE ELEMENT[{}]", elementCount);
-                    }
-                    divergentBytesTotal = bitWiseLogDivergence("Elements[" + std::to_string(elementCount) + "]", tile1, tile2, displayAllDivergences, divergentBytesTotal);
+                    Logging::info("DIVERGENCE");
+                    Logging::info("TILE ELEMENT[{}]", i);
                 }
-                elementCount++;
+                divergentBytesTotal = bitWiseLogDivergence("Elements[" + std::to_string(i) + "]", tile1, tile2, displayAllDivergences, divergentBytesTotal);
             }
         }
         if (!displayAllDivergences && divergentBytesTotal > 0)
@@ -599,10 +792,15 @@ namespace OpenLoco::GameSaveCompare
         Logging::info("Comparing reference file {} to current GameState frame", path);
         FileStream referenceFile(path, StreamMode::read);
         auto referenceGameState = S5::importSave(referenceFile);
-        return compareGameStates(*currentS5GameState, referenceGameState->gameState, false);
+        auto divergentRegions = findDivergentRegions(*currentS5GameState, referenceGameState->gameState, {}, {}, false);
+        if (!divergentRegions.any())
+        {
+            return true;
+        }
+        return compareGameStates(*currentS5GameState, referenceGameState->gameState, false, divergentRegions);
     }
 
-    bool compareGameStates(const fs::path& path1, const fs::path& path2, bool displayAllDivergences)
+    bool compareGameStates(const fs::path& path1, const fs::path& path2, bool displayAllDivergences, bool summaryOnly)
     {
         Logging::info("Comparing game state files:");
         Logging::info("   file1: {}", path1);
@@ -612,8 +810,23 @@ namespace OpenLoco::GameSaveCompare
         auto state1 = S5::importSave(file1);
         FileStream file2(path2, StreamMode::read);
         auto state2 = S5::importSave(file2);
-        auto match = compareGameStates(state1->gameState, state2->gameState, displayAllDivergences);
-        match &= compareElements(state1->tileElements, state2->tileElements, displayAllDivergences);
+
+        auto divergentRegions = findDivergentRegions(state1->gameState, state2->gameState, state1->tileElements, state2->tileElements, summaryOnly);
+        if (!divergentRegions.any())
+        {
+            return true;
+        }
+        if (summaryOnly)
+        {
+            logDivergenceSummary(divergentRegions);
+            return false;
+        }
+
+        auto match = compareGameStates(state1->gameState, state2->gameState, displayAllDivergences, divergentRegions);
+        if (divergentRegions.contains(kTileElementsRegion))
+        {
+            match &= compareElements(state1->tileElements, state2->tileElements, displayAllDivergences);
+        }
         return match;
     }
 }
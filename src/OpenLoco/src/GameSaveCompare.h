@@ -5,5 +5,5 @@
 namespace OpenLoco::GameSaveCompare
 {
     bool compareGameStates(const fs::path& path);
-    bool compareGameStates(const fs::path& path1, const fs::path& path2, bool displayAllDivergences);
+    bool compareGameStates(const fs::path& path1, const fs::path& path2, bool displayAllDivergences, bool summaryOnly);
 }
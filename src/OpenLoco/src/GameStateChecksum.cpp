@@ -0,0 +1,217 @@
+#include "GameStateChecksum.h"
+#include "Entities/Entity.h"
+#include "GameState.h"
+#include "Map/TileManager.h"
+#include "Vehicles/Vehicle.h"
+#include <OpenLoco/Core/EnumFlags.hpp>
+#include <OpenLoco/Engine/World.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace OpenLoco::GameStateChecksum
+{
+    static constexpr std::array<std::string_view, kNumSubsystems> kSubsystemNames = {
+        "General",
+        "Companies",
+        "Orders",
+        "Entities",
+        "Stations",
+        "Towns",
+        "Industries",
+        "TileElements",
+    };
+
+    // Multiplicative hash over 32 bit words, order dependent and fast enough to run every tick
+    class Hasher
+    {
+    private:
+        uint32_t _state = 0x811C9DC5;
+
+        void mix(uint32_t value)
+        {
+            value *= 0xCC9E2D51;
+            value = (value << 15) | (value >> 17);
+            value *= 0x1B873593;
+            _state ^= value;
+            _state = (_state << 13) | (_state >> 19);
+            _state = _state * 5 + 0xE6546B64;
+        }
+
+    public:
+        void add(const void* data, size_t length)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            for (; length >= sizeof(uint32_t); length -= sizeof(uint32_t), bytes += sizeof(uint32_t))
+            {
+                uint32_t value;
+                std::memcpy(&value, bytes, sizeof(value));
+                mix(value);
+            }
+            uint32_t tail = 0;
+            std::memcpy(&tail, bytes, length);
+            mix(tail ^ static_cast<uint32_t>(length));
+        }
+
+        template<typename T>
+        void add(const T& value)
+        {
+            add(&value, sizeof(T));
+        }
+
+        uint32_t get() const
+        {
+            return _state;
+        }
+    };
+
+    std::string_view getSubsystemName(Subsystem subsystem)
+    {
+        return kSubsystemNames[enumValue(subsystem)];
+    }
+
+    static uint32_t hashGeneral(const GameState& gameState)
+    {
+        Hasher hasher;
+        hasher.add(gameState.rng);
+        hasher.add(gameState.unkRng);
+        hasher.add(gameState.currentDay);
+        hasher.add(gameState.dayCounter);
+        hasher.add(gameState.scenarioTicks);
+        hasher.add(gameState.entityListCounts);
+        hasher.add(gameState.orderTableLength);
+        hasher.add(gameState.numMapAnimations);
+        return hasher.get();
+    }
+
+    // Hashes the items in use, skipping length bytes at offset which hold locally derived data
+    template<typename T, size_t N>
+    static uint32_t hashUsed(const T (&items)[N], size_t skipOffset = 0, size_t skipLength = 0)
+    {
+        Hasher hasher;
+        for (size_t i = 0; i < N; i++)
+        {
+            if (!items[i].empty())
+            {
+                const auto* data = reinterpret_cast<const uint8_t*>(&items[i]);
+                hasher.add(static_cast<uint32_t>(i));
+                hasher.add(data, skipOffset);
+                hasher.add(data + skipOffset + skipLength, sizeof(T) - skipOffset - skipLength);
+            }
+        }
+        return hasher.get();
+    }
+
+    static uint32_t hashEntities(const GameState& gameState)
+    {
+        // The sprite bounds are calculated for the local viewport rotation
+        constexpr size_t kSpriteBoundsStart = offsetof(EntityBase, spriteLeft);
+        constexpr size_t kSpriteBoundsEnd = offsetof(EntityBase, spriteYaw);
+
+        // The sound channel a vehicle plays in is chosen by the audio update for the local viewports
+        constexpr size_t kSoundChannelStart = offsetof(Vehicles::Vehicle2or6, soundFlags);
+        constexpr size_t kSoundChannelEnd = offsetof(Vehicles::Vehicle2or6, soundWindowType) + sizeof(Ui::WindowType);
+
+        Hasher hasher;
+        for (const auto& entity : gameState.entities)
+        {
+            if (entity.empty())
+            {
+                continue;
+            }
+            std::array<uint8_t, sizeof(Entity)> data;
+            std::memcpy(data.data(), &entity, data.size());
+            std::fill(data.begin() + kSpriteBoundsStart, data.begin() + kSpriteBoundsEnd, 0);
+
+            const auto* vehicle = entity.asBase<Vehicles::VehicleBase>();
+            if (vehicle != nullptr && (vehicle->isVehicle2() || vehicle->isVehicleTail()))
+            {
+                std::fill(data.begin() + kSoundChannelStart, data.begin() + kSoundChannelEnd, 0);
+            }
+            hasher.add(data);
+        }
+        return hasher.get();
+    }
+
+    static uint32_t hashTileElements(uint32_t tick)
+    {
+        const auto segment = tick % kTileElementSegments;
+        const auto firstRow = static_cast<tile_coord_t>(World::kMapRows * segment / kTileElementSegments);
+        const auto lastRow = static_cast<tile_coord_t>(World::kMapRows * (segment + 1) / kTileElementSegments);
+
+        Hasher hasher;
+        for (tile_coord_t y = firstRow; y < lastRow; y++)
+        {
+            for (tile_coord_t x = 0; x < World::kMapColumns; x++)
+            {
+                const auto tile = World::TileManager::get(World::TilePos2(x, y));
+                for (const auto& element : tile)
+                {
+                    // Ghosts are construction previews of the local player and move the last element flag
+                    if (element.isGhost())
+                    {
+                        continue;
+                    }
+                    std::array<uint8_t, World::kTileElementSize> data;
+                    std::memcpy(data.data(), &element, data.size());
+                    data[1] &= ~World::ElementFlags::last;
+                    hasher.add(data);
+                }
+                hasher.add(uint32_t{ 0xFFFFFFFF });
+            }
+        }
+        return hasher.get();
+    }
+
+    Checksums compute(uint32_t tick)
+    {
+        const auto& gameState = getGameState();
+
+        Checksums checksums{};
+        checksums[enumValue(Subsystem::general)] = hashGeneral(gameState);
+        checksums[enumValue(Subsystem::companies)] = hashUsed(gameState.companies);
+        {
+            Hasher hasher;
+            hasher.add(gameState.orders, std::min<size_t>(gameState.orderTableLength, sizeof(gameState.orders)));
+            checksums[enumValue(Subsystem::orders)] = hasher.get();
+        }
+        checksums[enumValue(Subsystem::entities)] = hashEntities(gameState);
+        // Label frames are measured in the local language
+        checksums[enumValue(Subsystem::stations)] = hashUsed(gameState.stations, offsetof(Station, labelFrame), sizeof(LabelFrame));
+        checksums[enumValue(Subsystem::towns)] = hashUsed(gameState.towns, offsetof(Town, labelFrame), sizeof(LabelFrame));
+        checksums[enumValue(Subsystem::industries)] = hashUsed(gameState.industries);
+        checksums[enumValue(Subsystem::tileElements)] = hashTileElements(tick);
+        return checksums;
+    }
+
+    std::optional<Subsystem> findFirstDivergence(const Checksums& a, const Checksums& b)
+    {
+        for (size_t i = 0; i < kNumSubsystems; i++)
+        {
+            if (a[i] != b[i])
+            {
+                return static_cast<Subsystem>(i);
+            }
+        }
+        return std::nullopt;
+    }
+
+    void History::add(uint32_t tick, const Checksums& checksums)
+    {
+        _entries[tick % _entries.size()] = { tick, true, checksums };
+    }
+
+    const Checksums* History::find(uint32_t tick) const
+    {
+        const auto& entry = _entries[tick % _entries.size()];
+        if (!entry.valid || entry.tick != tick)
+        {
+            return nullptr;
+        }
+        return &entry.checksums;
+    }
+
+    void History::clear()
+    {
+        _entries = {};
+    }
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace OpenLoco::GameStateChecksum
+{
+    // Parts of the game state hashed separately, in the order divergences are reported
+    enum class Subsystem : uint8_t
+    {
+        general,
+        companies,
+        orders,
+        entities,
+        stations,
+        towns,
+        industries,
+        tileElements,
+    };
+    constexpr size_t kNumSubsystems = 8;
+
+    using Checksums = std::array<uint32_t, kNumSubsystems>;
+
+    // The map is hashed a band of rows per tick so that a full pass takes this many ticks
+    constexpr uint32_t kTileElementSegments = 16;
+
+    std::string_view getSubsystemName(Subsystem subsystem);
+
+    // Hashes the deterministic parts of the game state, leaving out anything that depends on the
+    // local view such as sprite bounds and ghost elements. Both sides must pass the same tick.
+    Checksums compute(uint32_t tick);
+
+    std::optional<Subsystem> findFirstDivergence(const Checksums& a, const Checksums& b);
+
+    // Checksums of recent ticks, used to compare against a peer that is ahead or behind
+    class History
+    {
+    private:
+        struct Entry
+        {
+            uint32_t tick;
+            bool valid;
+            Checksums checksums;
+        };
+
+        std::array<Entry, 256> _entries{};
+
+    public:
+        void add(uint32_t tick, const Checksums& checksums);
+        const Checksums* find(uint32_t tick) const;
+        void clear();
+    };
+}
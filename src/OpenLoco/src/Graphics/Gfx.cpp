@@ -14,10 +14,12 @@
 #include "Ui.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/MemoryMappedFile.h>
 #include <OpenLoco/Core/Stream.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -36,6 +38,7 @@ namespace OpenLoco::Gfx
     static loco_global<G1Element[G1ExpectedCount::kDisc + kG1CountTemporary + G1ExpectedCount::kObjects], 0x9E2424> _g1Elements;
 
     static std::unique_ptr<std::byte[]> _g1Buffer;
+    static MemoryMappedFile _g1File;
 
     static loco_global<uint8_t[224 * 4], 0x112C884> _characterWidths;
 
@@ -52,7 +55,7 @@ namespace OpenLoco::Gfx
         }
     }
 
-    static std::vector<G1Element> convertElements(const std::vector<G1Element32>& elements32)
+    static std::vector<G1Element> convertElements(std::span<const G1Element32> elements32)
     {
         auto elements = std::vector<G1Element>();
         elements.reserve(elements32.size());
@@ -64,22 +67,8 @@ namespace OpenLoco::Gfx
         return elements;
     }
 
-    // 0x0044733C
-    void loadG1()
+    static void checkG1Header(const G1Header& header)
     {
-        auto g1Path = Environment::getPath(Environment::PathId::g1);
-        std::ifstream stream(g1Path, std::ios::in | std::ios::binary);
-        if (!stream)
-        {
-            throw Exception::RuntimeError("Opening g1 file failed.");
-        }
-
-        G1Header header;
-        if (!readData(stream, header))
-        {
-            throw Exception::RuntimeError("Reading g1 file header failed.");
-        }
-
         if (header.numEntries != G1ExpectedCount::kDisc)
         {
             if (header.numEntries == G1ExpectedCount::kSteam)
@@ -91,66 +80,146 @@ namespace OpenLoco::Gfx
                 Logging::warn("G1 element count doesn't match expected value:\nExpected {}; Got {}", G1ExpectedCount::kDisc, header.numEntries);
             }
         }
+    }
 
-        // Read element headers
-        auto elements32 = std::vector<G1Element32>(header.numEntries);
-        if (!readData(stream, elements32.data(), header.numEntries))
+    // Fills the element table from the file headers, elementData must outlive the table
+    static void setG1Elements(const G1Header& header, std::span<const G1Element32> elements32, std::byte* elementData)
+    {
+        if (header.numEntries != G1ExpectedCount::kSteam)
         {
-            throw Exception::RuntimeError("Reading g1 element headers failed.");
+            // Convert straight into the table, no fix ups required
+            auto* dst = _g1Elements.get();
+            for (const auto& src : elements32)
+            {
+                *dst = G1Element(src);
+                dst->offset = reinterpret_cast<uint8_t*>(elementData) + src.offset;
+                dst++;
+            }
+            return;
         }
-        auto elements = convertElements(elements32);
 
-        // Read element data
-        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
-        if (!readData(stream, elementData.get(), header.totalSize))
-        {
-            throw Exception::RuntimeError("Reading g1 elements failed.");
-        }
-        stream.close();
+        auto elements = convertElements(elements32);
 
         // The steam G1.DAT is missing two localised tutorial icons, and a smaller font variant
         // This code copies the closest variants into their place, and moves other elements accordingly
-        if (header.numEntries == G1ExpectedCount::kSteam)
+
+        // Temporarily convert offsets to absolute indexes
+        for (size_t i = 0; i < elements.size(); i++)
         {
-            // Temporarily convert offsets to absolute indexes
-            for (size_t i = 0; i < elements.size(); i++)
+            if (elements[i].hasFlags(G1ElementFlags::hasZoomSprites))
             {
-                if (elements[i].hasFlags(G1ElementFlags::hasZoomSprites))
-                {
-                    elements[i].zoomOffset = static_cast<int16_t>(i - elements[i].zoomOffset);
-                }
+                elements[i].zoomOffset = static_cast<int16_t>(i - elements[i].zoomOffset);
             }
+        }
 
-            elements.resize(G1ExpectedCount::kDisc);
+        elements.resize(G1ExpectedCount::kDisc);
 
-            // Extra two tutorial images
-            std::copy_n(&elements[3549], header.numEntries - 3549, &elements[3551]);
-            std::copy_n(&elements[3551], 1, &elements[3549]);
-            std::copy_n(&elements[3551], 1, &elements[3550]);
+        // Extra two tutorial images
+        std::copy_n(&elements[3549], header.numEntries - 3549, &elements[3551]);
+        std::copy_n(&elements[3551], 1, &elements[3549]);
+        std::copy_n(&elements[3551], 1, &elements[3550]);
 
-            // Extra font variant
-            std::copy_n(&elements[1788], 223, &elements[3898]);
+        // Extra font variant
+        std::copy_n(&elements[1788], 223, &elements[3898]);
 
-            // Restore relative offsets
-            for (size_t i = 0; i < elements.size(); i++)
+        // Restore relative offsets
+        for (size_t i = 0; i < elements.size(); i++)
+        {
+            if (elements[i].hasFlags(G1ElementFlags::hasZoomSprites))
             {
-                if (elements[i].hasFlags(G1ElementFlags::hasZoomSprites))
-                {
-                    elements[i].zoomOffset = static_cast<int16_t>(i - elements[i].zoomOffset);
-                }
+                elements[i].zoomOffset = static_cast<int16_t>(i - elements[i].zoomOffset);
             }
         }
 
         // Adjust memory offsets
         for (auto& element : elements)
         {
-            element.offset += (uintptr_t)elementData.get();
+            element.offset += (uintptr_t)elementData;
         }
 
-        _g1Buffer = std::move(elementData);
         std::copy(elements.begin(), elements.end(), _g1Elements.get());
     }
 
+    // Sprite data is paged in from the file on first use rather than read up front
+    static bool loadG1Mapped(const fs::path& g1Path)
+    {
+        MemoryMappedFile file;
+        if (!file.open(g1Path))
+        {
+            Logging::warn("Mapping g1 file failed, reading it instead.");
+            return false;
+        }
+
+        if (file.getLength() < sizeof(G1Header))
+        {
+            throw Exception::RuntimeError("Reading g1 file header failed.");
+        }
+        G1Header header;
+        std::memcpy(&header, file.data(), sizeof(header));
+        checkG1Header(header);
+
+        const auto headersSize = static_cast<size_t>(header.numEntries) * sizeof(G1Element32);
+        if (file.getLength() - sizeof(G1Header) < headersSize)
+        {
+            throw Exception::RuntimeError("Reading g1 element headers failed.");
+        }
+        if (file.getLength() - sizeof(G1Header) - headersSize < header.totalSize)
+        {
+            throw Exception::RuntimeError("Reading g1 elements failed.");
+        }
+
+        const auto* elements32 = reinterpret_cast<const G1Element32*>(file.data() + sizeof(G1Header));
+        auto* elementData = file.data() + sizeof(G1Header) + headersSize;
+        setG1Elements(header, { elements32, header.numEntries }, elementData);
+
+        _g1Buffer.reset();
+        _g1File = std::move(file);
+        return true;
+    }
+
+    // 0x0044733C
+    void loadG1()
+    {
+        auto g1Path = Environment::getPath(Environment::PathId::g1);
+        if (Config::get().memoryMappedG1 && loadG1Mapped(g1Path))
+        {
+            return;
+        }
+
+        std::ifstream stream(g1Path, std::ios::in | std::ios::binary);
+        if (!stream)
+        {
+            throw Exception::RuntimeError("Opening g1 file failed.");
+        }
+
+        G1Header header;
+        if (!readData(stream, header))
+        {
+            throw Exception::RuntimeError("Reading g1 file header failed.");
+        }
+        checkG1Header(header);
+
+        // Read element headers
+        auto elements32 = std::vector<G1Element32>(header.numEntries);
+        if (!readData(stream, elements32.data(), header.numEntries))
+        {
+            throw Exception::RuntimeError("Reading g1 element headers failed.");
+        }
+
+        // Read element data
+        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
+        if (!readData(stream, elementData.get(), header.totalSize))
+        {
+            throw Exception::RuntimeError("Reading g1 elements failed.");
+        }
+        stream.close();
+
+        setG1Elements(header, elements32, elementData.get());
+
+        _g1File.close();
+        _g1Buffer = std::move(elementData);
+    }
+
     // 0x004949BC
     void initialiseCharacterWidths()
     {
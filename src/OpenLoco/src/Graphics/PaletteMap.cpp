@@ -22,8 +22,8 @@ namespace OpenLoco::Gfx::PaletteMap
     }();
 
     // This buffer is used when sprites are drawn with a secondary palette.
-    // TODO: Make this thread safe via thread_local if multi-threading is implemented.
-    static auto _secondaryPaletteMapBuffer = _defaultPaletteMapBuffer;
+    // Thread local as viewport columns can be drawn from multiple threads.
+    static thread_local auto _secondaryPaletteMapBuffer = _defaultPaletteMapBuffer;
 
     View getDefault()
     {
@@ -7,6 +7,7 @@
 #include "IndustryElement.h"
 #include <OpenLoco/Interop/Interop.hpp>
 #include <array>
+#include <unordered_set>
 
 using namespace OpenLoco::Interop;
 
@@ -22,19 +23,51 @@ namespace OpenLoco::World::AnimationManager
         return getGameState().numMapAnimations;
     }
 
+    // Keys of every animation in use so duplicates are rejected without scanning the animations.
+    // Rebuilding drops any duplicates the animations were loaded with, so from then on the animations
+    // never hold duplicates and the index is out of date whenever its size differs.
+    static std::unordered_set<uint64_t> _index;
+
+    static uint64_t getIndexKey(uint8_t type, const Pos2& pos, tile_coord_t baseZ)
+    {
+        return (static_cast<uint64_t>(type) << 40) | (static_cast<uint64_t>(static_cast<uint16_t>(pos.x)) << 24) | (static_cast<uint64_t>(static_cast<uint16_t>(pos.y)) << 8) | static_cast<uint8_t>(baseZ);
+    }
+
+    static uint64_t getIndexKey(const Animation& animation)
+    {
+        return getIndexKey(animation.type, animation.pos, animation.baseZ);
+    }
+
+    void rebuildIndex()
+    {
+        _index.clear();
+        _index.reserve(Limits::kMaxAnimations);
+
+        // Saves may contain duplicate animations, keep the first of each
+        uint16_t last = 0;
+        for (uint16_t i = 0; i < numAnimations(); i++)
+        {
+            if (_index.insert(getIndexKey(rawAnimations()[i])).second)
+            {
+                rawAnimations()[last++] = rawAnimations()[i];
+            }
+        }
+        numAnimations() = last;
+    }
+
     // 0x004612A6
     void createAnimation(uint8_t type, const Pos2& pos, tile_coord_t baseZ)
     {
         if (numAnimations() >= Limits::kMaxAnimations)
             return;
 
-        for (size_t i = 0; i < numAnimations(); i++)
+        if (_index.size() != numAnimations())
         {
-            auto& animation = rawAnimations()[i];
-            if (animation.type == type && animation.pos == pos && animation.baseZ == baseZ)
-            {
-                return;
-            }
+            rebuildIndex();
+        }
+        if (!_index.insert(getIndexKey(type, pos, baseZ)).second)
+        {
+            return;
         }
 
         auto& newAnimation = rawAnimations()[numAnimations()++];
@@ -47,6 +80,7 @@ namespace OpenLoco::World::AnimationManager
     void reset()
     {
         numAnimations() = 0;
+        _index.clear();
     }
 
     static bool callUpdateFunction(Animation& anim)
@@ -92,6 +126,18 @@ namespace OpenLoco::World::AnimationManager
                 animsToRemove[i] = callUpdateFunction(animation);
             }
 
+            if (_index.size() != numAnimations())
+            {
+                rebuildIndex();
+            }
+            for (uint16_t i = 0; i < numAnimations(); ++i)
+            {
+                if (animsToRemove[i])
+                {
+                    _index.erase(getIndexKey(rawAnimations()[i]));
+                }
+            }
+
             // Remove animations that are no longer required
             uint16_t last = 0;
             for (uint16_t i = 0; i < numAnimations(); ++i, ++last)
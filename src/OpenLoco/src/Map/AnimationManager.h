@@ -5,6 +5,8 @@ namespace OpenLoco::World::AnimationManager
 {
     void createAnimation(uint8_t type, const Pos2& pos, tile_coord_t baseZ);
     void reset();
+    // Call after the animations have been replaced outside of AnimationManager, e.g. by loading a game
+    void rebuildIndex();
     void update();
     void registerHooks();
 }
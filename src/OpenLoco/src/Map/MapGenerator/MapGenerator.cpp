@@ -22,6 +22,7 @@
 #include "SimplexTerrainGenerator.h"
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
+#include "Vehicles/Vehicle.h"
 #include <OpenLoco/Interop/Interop.hpp>
 #include <cassert>
 #include <cstdint>
@@ -636,6 +637,7 @@ namespace OpenLoco::World::MapGenerator
         Scenario::initialiseDate(options.scenarioStartYear);
         Scenario::initialiseSnowLine();
         TileManager::initialise();
+        Vehicles::invalidateTrackNetworkCache();
         updateProgress(10);
 
         {
@@ -18,16 +18,6 @@ namespace OpenLoco::World
         return (uint8_t*)this;
     }
 
-    ElementType TileElementBase::type() const
-    {
-        return (ElementType)((_type & 0x3C) >> 2);
-    }
-
-    bool TileElementBase::isLast() const
-    {
-        return (_flags & ElementFlags::last) != 0;
-    }
-
     Tile::Tile(const TilePos2& tPos, TileElement* data)
         : _data(data)
         , pos(tPos)
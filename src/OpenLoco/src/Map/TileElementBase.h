@@ -43,7 +43,7 @@ namespace OpenLoco::World
     public:
         // Temporary, use this to get fields easily before they are defined
         const uint8_t* data() const;
-        ElementType type() const;
+        ElementType type() const { return (ElementType)((_type & 0x3C) >> 2); }
         void setType(ElementType t)
         {
             // Purposely clobers any other data in _type
@@ -76,7 +76,7 @@ namespace OpenLoco::World
         }
         void setBaseZ(uint8_t baseZ) { _baseZ = baseZ; }
         void setClearZ(uint8_t value) { _clearZ = value; }
-        bool isLast() const;
+        bool isLast() const { return (_flags & ElementFlags::last) != 0; }
         void setLastFlag(bool state)
         {
             _flags &= ~ElementFlags::last;
@@ -0,0 +1,108 @@
+#include "TileIndex.h"
+#include <algorithm>
+
+namespace OpenLoco::World
+{
+    void TileIndex::resize(size_t numTiles)
+    {
+        _entries.clear();
+        _entries.shrink_to_fit();
+        _entries.resize(numTiles);
+        clear();
+    }
+
+    void TileIndex::clear()
+    {
+        _transportElements.clear();
+        _generation++;
+        if (_generation == 0)
+        {
+            std::fill(_entries.begin(), _entries.end(), Entry{});
+            _generation = 1;
+        }
+    }
+
+    // Vanilla code still inserts and removes elements without going through TileManager. Inserting
+    // moves the tile to the end of the element buffer and removing shifts the remaining elements up,
+    // so an entry is only trusted while the tile starts and ends where it did. Changes that keep the
+    // tile in place are only caught by clear.
+    const TileIndex::Entry* TileIndex::find(size_t tileIndex, const TileElement* elements, const TileElement* first) const
+    {
+        if (tileIndex >= _entries.size())
+        {
+            return nullptr;
+        }
+        const auto& entry = _entries[tileIndex];
+        if (entry.generation != _generation || first != elements + entry.firstElement)
+        {
+            return nullptr;
+        }
+        const auto* last = first + entry.numElements - 1;
+        if (!last->isLast() || (entry.numElements != 1 && (last - 1)->isLast()))
+        {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    const TileIndex::Entry* TileIndex::build(size_t tileIndex, TileElement* elements, TileElement* first)
+    {
+        if (tileIndex >= _entries.size())
+        {
+            return nullptr;
+        }
+        auto& entry = _entries[tileIndex];
+        return buildEntry(entry, elements, first) ? &entry : nullptr;
+    }
+
+    bool TileIndex::buildEntry(Entry& entry, TileElement* elements, TileElement* first)
+    {
+        if (_transportElements.size() >= kMaxTransportElements)
+        {
+            clear();
+        }
+
+        Entry newEntry{};
+        newEntry.generation = _generation;
+        newEntry.firstElement = static_cast<uint32_t>(first - elements);
+        newEntry.transportStart = static_cast<uint32_t>(_transportElements.size());
+        newEntry.surfaceIndex = kNoSurfaceIndex;
+
+        size_t numElements = 0;
+        for (auto* el = first;; ++el)
+        {
+            if (numElements == kMaxIndexedElements)
+            {
+                _transportElements.resize(newEntry.transportStart);
+                return false;
+            }
+
+            const auto type = el->type();
+            newEntry.typeMask |= 1U << enumValue(type);
+            if (type == ElementType::surface && newEntry.surfaceIndex == kNoSurfaceIndex)
+            {
+                newEntry.surfaceIndex = static_cast<uint8_t>(numElements);
+            }
+            else if (isTransportElement(type))
+            {
+                _transportElements.push_back(el);
+            }
+            numElements++;
+
+            if (el->isLast())
+            {
+                break;
+            }
+        }
+
+        newEntry.numElements = static_cast<uint8_t>(numElements);
+        newEntry.numTransport = static_cast<uint8_t>(_transportElements.size() - newEntry.transportStart);
+        entry = newEntry;
+        return true;
+    }
+
+    std::span<TileElement* const> TileIndex::getTransportElements(const Entry& entry) const
+    {
+        return std::span<TileElement* const>(_transportElements.data() + entry.transportStart, entry.numTransport);
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "TileElement.h"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace OpenLoco::World
+{
+    // Summary of each tile of an element buffer, backs the optional tile index of TileManager.
+    // Entries are built on first use and dropped by clear, which has to be called whenever elements
+    // may have changed without the tile being moved or resized.
+    class TileIndex
+    {
+    public:
+        struct Entry
+        {
+            uint32_t generation;     // Entries from older generations are stale, 0 is never built
+            uint32_t firstElement;   // Offset of the first element of the tile from the element buffer
+            uint32_t transportStart; // Offset of the tiles transport elements in _transportElements
+            uint16_t typeMask;       // Bit per ElementType present on the tile
+            uint8_t numElements;
+            uint8_t surfaceIndex;
+            uint8_t numTransport;
+        };
+
+        static constexpr uint8_t kNoSurfaceIndex = 0xFF;
+        // Tiles with more elements than this are not indexed
+        static constexpr size_t kMaxIndexedElements = 0xFF;
+        // Tiles rebuilt within a generation leave their old transport elements behind, start afresh past this
+        static constexpr size_t kMaxTransportElements = 0x40000;
+
+    private:
+        uint32_t _generation = 1;
+        std::vector<Entry> _entries;
+        std::vector<TileElement*> _transportElements;
+
+        bool buildEntry(Entry& entry, TileElement* elements, TileElement* first);
+
+    public:
+        static bool isTransportElement(ElementType type)
+        {
+            return type == ElementType::track || type == ElementType::road || type == ElementType::station;
+        }
+
+        void resize(size_t numTiles);
+        // Drops every entry
+        void clear();
+
+        // Returns the entry of the tile if it is still valid, first is the first element of the tile in elements
+        const Entry* find(size_t tileIndex, const TileElement* elements, const TileElement* first) const;
+        // Returns nullptr when the tile cannot be indexed
+        const Entry* build(size_t tileIndex, TileElement* elements, TileElement* first);
+
+        std::span<TileElement* const> getTransportElements(const Entry& entry) const;
+    };
+}
@@ -28,6 +28,7 @@
 #include "StationElement.h"
 #include "SurfaceElement.h"
 #include "TileClearance.h"
+#include "TileIndex.h"
 #include "TrackElement.h"
 #include "TreeElement.h"
 #include "Ui.h"
@@ -40,7 +41,11 @@
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
+#include <optional>
 #include <set>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -53,6 +58,31 @@ namespace OpenLoco::World::TileManager
     static loco_global<const TileElement*, 0x00F00158> _F00158;
     static loco_global<uint32_t, 0x00F00168> _F00168;
 
+    static bool _indexEnabled = false;
+    static TileIndex _index;
+    static std::vector<TileElement*> _unindexedTransportElements;
+    static std::array<IndexStatistics, kNumIndexQueries> _indexStatistics;
+
+    // Incremental compaction, see compactElements
+    // Number of elements a step may move or step over
+    static constexpr uint32_t kCompactionRegionSize = 0x4000;
+    // A pass is started once fewer elements than this are free at the end of the buffer
+    static constexpr uint32_t kCompactionFreeThreshold = maxElements / 4;
+    // and the buffer has grown by at least this much since the last pass, holes are only
+    // left behind when tiles are moved to the end of the buffer
+    static constexpr uint32_t kCompactionMinGrowth = 0x1000;
+
+    static bool _compactionActive = false;
+    static int32_t _compactionTile = 0;         // Tiles before this one in map order have been packed in the current pass
+    static uint32_t _compactionWriteOffset = 0; // End of the packed tiles
+    static uint32_t _compactedEnd = 0;          // Number of used elements at the end of the last pass
+    static std::vector<uint32_t> _compactionTileAt; // Tile index by the offset of its first element, only valid if the tile pointer agrees
+
+    void invalidateIndex()
+    {
+        _index.clear();
+    }
+
     // 0x0046902E
     void removeSurfaceIndustry(const Pos2& pos)
     {
@@ -134,6 +164,8 @@ namespace OpenLoco::World::TileManager
     // 0x00461760
     void removeElement(TileElement& element)
     {
+        invalidateIndex();
+
         // This is used to indicate if the caller can still use this pointer
         if (&element == *_F00158)
         {
@@ -184,6 +216,7 @@ namespace OpenLoco::World::TileManager
         call(0x004616D6, regs);
         TileElement* el = X86Pointer<TileElement>(regs.esi);
         el->setType(type);
+        invalidateIndex();
         return el;
     }
 
@@ -199,6 +232,7 @@ namespace OpenLoco::World::TileManager
         call(0x00461578, regs);
         TileElement* el = X86Pointer<TileElement>(regs.esi);
         el->setType(type);
+        invalidateIndex();
         return el;
     }
 
@@ -246,6 +280,106 @@ namespace OpenLoco::World::TileManager
         _tiles[index] = elements;
     }
 
+    void setIndexEnabled(bool enabled)
+    {
+        _indexEnabled = enabled;
+        _index.resize(enabled ? _tiles.size() : 0);
+    }
+
+    bool isIndexEnabled()
+    {
+        return _indexEnabled;
+    }
+
+    // Returns nullptr when the index is disabled or cannot describe the tile
+    static const TileIndex::Entry* getIndexEntry(const TilePos2& pos, IndexQuery query)
+    {
+        if (!_indexEnabled)
+        {
+            return nullptr;
+        }
+
+        const auto index = getTileIndex(pos);
+        if (index >= _tiles.size())
+        {
+            return nullptr;
+        }
+        auto* first = _tiles[index];
+        if (first == kInvalidTile)
+        {
+            return nullptr;
+        }
+
+        auto& statistics = _indexStatistics[enumValue(query)];
+        statistics.lookups++;
+
+        if (const auto* entry = _index.find(index, *_elements, first); entry != nullptr)
+        {
+            statistics.hits++;
+            return entry;
+        }
+        return _index.build(index, *_elements, first);
+    }
+
+    SurfaceElement* getSurface(const TilePos2& pos)
+    {
+        const auto* entry = getIndexEntry(pos, IndexQuery::surface);
+        if (entry == nullptr)
+        {
+            return get(pos).surface();
+        }
+        if (entry->surfaceIndex == TileIndex::kNoSurfaceIndex)
+        {
+            return nullptr;
+        }
+        return (*_elements + entry->firstElement + entry->surfaceIndex)->as<SurfaceElement>();
+    }
+
+    bool hasElementType(const TilePos2& pos, ElementType type)
+    {
+        const auto* entry = getIndexEntry(pos, IndexQuery::elementType);
+        if (entry == nullptr)
+        {
+            for (const auto& el : get(pos))
+            {
+                if (el.type() == type)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return (entry->typeMask & (1U << enumValue(type))) != 0;
+    }
+
+    std::span<TileElement* const> getTransportElements(const TilePos2& pos)
+    {
+        const auto* entry = getIndexEntry(pos, IndexQuery::transportElements);
+        if (entry == nullptr)
+        {
+            _unindexedTransportElements.clear();
+            for (auto& el : get(pos))
+            {
+                if (TileIndex::isTransportElement(el.type()))
+                {
+                    _unindexedTransportElements.push_back(&el);
+                }
+            }
+            return _unindexedTransportElements;
+        }
+        return _index.getTransportElements(*entry);
+    }
+
+    IndexStatistics getIndexStatistics(IndexQuery query)
+    {
+        return _indexStatistics[enumValue(query)];
+    }
+
+    void resetIndexStatistics()
+    {
+        _indexStatistics = {};
+    }
+
     constexpr uint8_t kTileSize = 31;
 
     static int16_t getOneCornerUpLandHeight(int8_t xl, int8_t yl, uint8_t slope)
@@ -373,9 +507,8 @@ namespace OpenLoco::World::TileManager
         if ((unsigned)pos.x >= (World::kMapWidth - 1) || (unsigned)pos.y >= (World::kMapHeight - 1))
             return height;
 
-        auto tile = TileManager::get(pos);
         // Get the surface element for the tile
-        auto surfaceEl = tile.surface();
+        auto surfaceEl = getSurface(World::toTileSpace(pos));
 
         if (surfaceEl == nullptr)
         {
@@ -492,6 +625,8 @@ namespace OpenLoco::World::TileManager
     void updateTilePointers()
     {
         clearTilePointers();
+        invalidateIndex();
+        _compactionActive = false;
 
         TileElement* el = _elements;
         for (tile_coord_t y = 0; y < kMapRows; y++)
@@ -509,6 +644,33 @@ namespace OpenLoco::World::TileManager
         }
 
         _elementsEnd = el;
+        _compactedEnd = static_cast<uint32_t>(el - *_elements);
+    }
+
+    static size_t copyElementsInMapOrder(TileElement* dst)
+    {
+        size_t numElements = 0;
+        for (tile_coord_t y = 0; y < kMapRows; y++)
+        {
+            for (tile_coord_t x = 0; x < kMapColumns; x++)
+            {
+                auto tile = get(TilePos2(x, y));
+                for (const auto& element : tile)
+                {
+                    dst[numElements] = element;
+                    numElements++;
+                }
+            }
+        }
+        return numElements;
+    }
+
+    std::vector<TileElement> getElementsInMapOrder()
+    {
+        // Every element in use belongs to a tile so the copy is never larger than the used part of the buffer
+        std::vector<TileElement> elements(getElements().size());
+        elements.resize(copyElementsInMapOrder(elements.data()));
+        return elements;
     }
 
     // 0x0046148F
@@ -523,19 +685,7 @@ namespace OpenLoco::World::TileManager
             std::vector<TileElement> tempBuffer;
             tempBuffer.resize(maxElements);
 
-            size_t numElements = 0;
-            for (tile_coord_t y = 0; y < kMapRows; y++)
-            {
-                for (tile_coord_t x = 0; x < kMapColumns; x++)
-                {
-                    auto tile = get(TilePos2(x, y));
-                    for (const auto& element : tile)
-                    {
-                        tempBuffer[numElements] = element;
-                        numElements++;
-                    }
-                }
-            }
+            const auto numElements = copyElementsInMapOrder(tempBuffer.data());
 
             // Copy organised elements back to original element buffer
             std::memcpy(_elements, tempBuffer.data(), numElements * sizeof(TileElement));
@@ -556,6 +706,208 @@ namespace OpenLoco::World::TileManager
         Ui::setCursor(curCursor);
     }
 
+    static void markCompactedElementsAsFree(TileElement* begin, TileElement* end)
+    {
+        for (auto* el = begin; el != end; ++el)
+        {
+            *el = TileElement{};
+            el->setBaseZ(255);
+        }
+    }
+
+    static bool isElementFree(const TileElement& element)
+    {
+        return element.baseZ() == 255;
+    }
+
+    static size_t getTileLength(const TileElement* first)
+    {
+        auto* last = first;
+        while (!last->isLast())
+        {
+            last++;
+        }
+        return static_cast<size_t>(last - first) + 1;
+    }
+
+    static void setCompactionTileAt(const TileElement* first, uint32_t tileIndex)
+    {
+        _compactionTileAt[first - *_elements] = tileIndex;
+    }
+
+    // Finds which tile starts at the element, only the tiles moved by vanilla code since the pass started need a search
+    static std::optional<uint32_t> findCompactionTileAt(const TileElement* first)
+    {
+        const auto tileIndex = _compactionTileAt[first - *_elements];
+        if (tileIndex < _tiles.size() && _tiles[tileIndex] == first)
+        {
+            return tileIndex;
+        }
+        for (uint32_t i = 0; i < _tiles.size(); ++i)
+        {
+            if (_tiles[i] == first)
+            {
+                setCompactionTileAt(first, i);
+                return i;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // Moves a tile to the end of the buffer like vanilla does when a tile has no room to grow
+    static bool evictTile(TileElement* first, uint32_t tileIndex, size_t length)
+    {
+        if (numFreeElements() < length)
+        {
+            return false;
+        }
+        auto* dst = *_elementsEnd;
+        std::memcpy(dst, first, length * sizeof(TileElement));
+        markCompactedElementsAsFree(first, first + length);
+        _elementsEnd = dst + length;
+        _tiles[tileIndex] = dst;
+        setCompactionTileAt(dst, tileIndex);
+        return true;
+    }
+
+    static void startCompaction()
+    {
+        _compactionActive = true;
+        _compactionTile = 0;
+        _compactionWriteOffset = 0;
+
+        _compactionTileAt.resize(maxElements);
+        for (uint32_t i = 0; i < _tiles.size(); ++i)
+        {
+            if (_tiles[i] != kInvalidTile)
+            {
+                setCompactionTileAt(_tiles[i], i);
+            }
+        }
+    }
+
+    static void finishCompaction()
+    {
+        auto* const elements = *_elements;
+        auto* dst = elements + _compactionWriteOffset;
+
+        // Tiles moved to the end by vanilla code during the pass stay where they are
+        auto* end = *_elementsEnd;
+        while (end > dst && isElementFree(*(end - 1)))
+        {
+            end--;
+        }
+        std::memset(end, 0, (*_elementsEnd - end) * sizeof(TileElement));
+        _elementsEnd = end;
+        _compactedEnd = static_cast<uint32_t>(end - elements);
+        _compactionActive = false;
+    }
+
+    // Packs the next tiles in map order down against the tiles packed so far, so that a finished pass leaves the
+    // elements in map order just like reorganise. Run every tick, a pass over the whole map is spread over many
+    // ticks rather than stalling the game like reorganise does. A step only touches the elements it moves, tiles in
+    // the way are moved to the end of the buffer and packed again once their turn comes. Tiles that vanilla code
+    // moves or grows in between steps are picked up from the tile pointers, so the pass carries on regardless.
+    void compactElements()
+    {
+        if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
+        {
+            return;
+        }
+
+        auto* const elements = *_elements;
+        if (!_compactionActive)
+        {
+            const auto usedElements = static_cast<uint32_t>(_elementsEnd - elements);
+            if (numFreeElements() > kCompactionFreeThreshold || usedElements < _compactedEnd + kCompactionMinGrowth)
+            {
+                return;
+            }
+            startCompaction();
+        }
+
+        auto* dst = elements + _compactionWriteOffset;
+
+        // The last packed tile may have grown in place since the last step
+        while (dst != elements && dst != *_elementsEnd && !isElementFree(*(dst - 1)) && !(dst - 1)->isLast())
+        {
+            dst++;
+        }
+
+        bool hasMoved = false;
+        size_t budget = kCompactionRegionSize;
+        for (; _compactionTile < kMapSize && budget > 0; _compactionTile++)
+        {
+            const auto tileIndex = static_cast<uint32_t>(getTileIndex(TilePos2(_compactionTile % kMapColumns, _compactionTile / kMapColumns)));
+            auto* src = _tiles[tileIndex];
+            if (src == kInvalidTile)
+            {
+                continue;
+            }
+            const auto length = getTileLength(src);
+            budget -= std::min(budget, length);
+            if (src == dst)
+            {
+                dst += length;
+                continue;
+            }
+
+            // Make room for the tile, anything in the way starts a tile as the packed tiles end on a last element
+            auto* cur = dst;
+            while (cur < dst + length && cur != src)
+            {
+                if (isElementFree(*cur))
+                {
+                    cur++;
+                    continue;
+                }
+                const auto blockingTile = findCompactionTileAt(cur);
+                const auto blockingLength = getTileLength(cur);
+                if (!blockingTile.has_value() || !evictTile(cur, *blockingTile, blockingLength))
+                {
+                    // Either the layout is not understood or there is no room left at the end, try again with a new pass
+                    _compactionWriteOffset = static_cast<uint32_t>(dst - elements);
+                    finishCompaction();
+                    if (hasMoved)
+                    {
+                        invalidateIndex();
+                    }
+                    return;
+                }
+                budget -= std::min(budget, blockingLength);
+                cur += blockingLength;
+            }
+
+            std::memmove(dst, src, length * sizeof(TileElement));
+            _tiles[tileIndex] = dst;
+            setCompactionTileAt(dst, tileIndex);
+
+            // Free whatever part of the old location the tile no longer covers
+            auto* srcEnd = src + length;
+            auto* dstEnd = dst + length;
+            if (src < dst)
+            {
+                markCompactedElementsAsFree(src, std::min(srcEnd, dst));
+            }
+            else
+            {
+                markCompactedElementsAsFree(std::max(src, dstEnd), srcEnd);
+            }
+            dst = dstEnd;
+            hasMoved = true;
+        }
+        if (hasMoved)
+        {
+            invalidateIndex();
+        }
+
+        _compactionWriteOffset = static_cast<uint32_t>(dst - elements);
+        if (_compactionTile == kMapSize)
+        {
+            finishCompaction();
+        }
+    }
+
     // 0x00461393
     bool checkFreeElementsAndReorganise()
     {
@@ -739,6 +1091,9 @@ namespace OpenLoco::World::TileManager
                 if (!World::validCoords(tilePos))
                     continue;
 
+                if (!hasElementType(tilePos, ElementType::tree))
+                    continue;
+
                 auto tile = get(tilePos);
                 for (auto& element : tile)
                 {
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <set>
 #include <span>
+#include <vector>
 
 namespace OpenLoco::World
 {
@@ -35,6 +36,8 @@ namespace OpenLoco::World::TileManager
     void allocateMapElements();
     void initialise();
     std::span<TileElement> getElements();
+    // A copy of the elements of every tile in map order, as reorganise would leave them, without changing the map
+    std::vector<TileElement> getElementsInMapOrder();
     TileElement* getElementsEnd();
     uint32_t numFreeElements();
     TileElement** getElementIndex();
@@ -70,6 +73,7 @@ namespace OpenLoco::World::TileManager
     SmallZ getSurfaceCornerDownHeight(const SurfaceElement& surface, const uint8_t cornerMask);
     void updateTilePointers();
     void reorganise();
+    void compactElements();
     bool checkFreeElementsAndReorganise();
     CompanyId getTileOwner(const World::TileElement& el);
     void mapInvalidateTileFull(World::Pos2 pos);
@@ -91,4 +95,36 @@ namespace OpenLoco::World::TileManager
     void setTerrainStyleAsCleared(const Pos2& pos);
     uint32_t adjustSurfaceHeight(World::Pos2 pos, SmallZ targetBaseZ, uint8_t slopeFlags, std::set<World::Pos3, LessThanPos3>& removedBuildings, uint8_t flags);
     uint32_t adjustWaterHeight(World::Pos2 pos, SmallZ targetHeight, std::set<World::Pos3, LessThanPos3>& removedBuildings, uint8_t flags);
+
+    // Optional cache of per tile lookups for hot callers that would otherwise walk every element of a tile.
+    // Entries are built on first use and rebuilt when the tile has been moved or resized since. Main thread only.
+    void setIndexEnabled(bool enabled);
+    bool isIndexEnabled();
+    // Drops the whole index. Vanilla code can change elements in place without moving the tile, so this
+    // is called whenever control returns from vanilla code that may have done so.
+    void invalidateIndex();
+
+    // The queries below fall back to walking the tile when the index is disabled
+    SurfaceElement* getSurface(const TilePos2& pos);
+    bool hasElementType(const TilePos2& pos, ElementType type);
+    // Track, road and station elements of the tile in element order.
+    // Note: Only valid until the next index query or tile modification
+    std::span<TileElement* const> getTransportElements(const TilePos2& pos);
+
+    enum class IndexQuery : uint8_t
+    {
+        surface,
+        elementType,
+        transportElements,
+    };
+    constexpr size_t kNumIndexQueries = 3;
+
+    struct IndexStatistics
+    {
+        uint64_t lookups;
+        uint64_t hits;
+    };
+
+    IndexStatistics getIndexStatistics(IndexQuery query);
+    void resetIndexStatistics();
 }
@@ -0,0 +1,254 @@
+#include "LoopbackBenchmark.h"
+#include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace OpenLoco::Network::LoopbackBenchmark
+{
+    // How often the game loop updates the connections, the receive loop is polled every millisecond
+    constexpr uint32_t kUpdateInterval = 25;
+    // Datagrams that would wait longer than this for the link are dropped, as a router queue would
+    constexpr uint32_t kMaxQueueDelay = 200;
+    constexpr uint32_t kTimeout = 60000;
+
+    // One direction of the simulated link
+    class LoopbackLink
+    {
+    private:
+        struct Datagram
+        {
+            uint32_t deliveryTime;
+            std::vector<uint8_t> data;
+        };
+
+        std::mutex _sync;
+        std::deque<Datagram> _datagrams;
+        std::mt19937 _rng;
+        const Options& _options;
+        double _linkFreeTime{};
+        uint32_t _dropped{};
+
+    public:
+        LoopbackLink(const Options& options, uint32_t seed)
+            : _rng(seed)
+            , _options(options)
+        {
+        }
+
+        void send(const void* buffer, size_t size)
+        {
+            std::unique_lock<std::mutex> lk(_sync);
+            const auto now = static_cast<double>(Platform::getTime());
+            const auto sendStart = std::max(now, _linkFreeTime);
+            if (sendStart - now > kMaxQueueDelay || _rng() % 100 < _options.packetLoss)
+            {
+                _dropped++;
+                return;
+            }
+
+            _linkFreeTime = sendStart + static_cast<double>(size) / std::max<uint32_t>(_options.bandwidth, 1);
+            const auto* bytes = static_cast<const uint8_t*>(buffer);
+            const auto deliveryTime = static_cast<uint32_t>(_linkFreeTime) + _options.latency;
+            _datagrams.push_back({ deliveryTime, std::vector<uint8_t>(bytes, bytes + size) });
+        }
+
+        bool receive(void* buffer, size_t size, size_t* sizeReceived)
+        {
+            std::unique_lock<std::mutex> lk(_sync);
+            if (_datagrams.empty() || _datagrams.front().deliveryTime > Platform::getTime())
+            {
+                return false;
+            }
+            const auto& datagram = _datagrams.front();
+            *sizeReceived = std::min(size, datagram.data.size());
+            std::memcpy(buffer, datagram.data.data(), *sizeReceived);
+            _datagrams.pop_front();
+            return true;
+        }
+
+        uint32_t getDropped()
+        {
+            std::unique_lock<std::mutex> lk(_sync);
+            return _dropped;
+        }
+    };
+
+    class LoopbackEndpoint final : public INetworkEndpoint
+    {
+    public:
+        Protocol getProtocol() const override { return Protocol::ipv4; }
+        std::string getIpAddress() const override { return "loopback"; }
+        std::string getHostname() const override { return "loopback"; }
+        std::unique_ptr<INetworkEndpoint> clone() const override { return std::make_unique<LoopbackEndpoint>(); }
+        bool equals(const INetworkEndpoint& other) const override { return dynamic_cast<const LoopbackEndpoint*>(&other) != nullptr; }
+    };
+
+    class LoopbackSocket final : public IUdpSocket
+    {
+    private:
+        LoopbackLink& _outgoing;
+        LoopbackLink& _incoming;
+
+    public:
+        LoopbackSocket(LoopbackLink& outgoing, LoopbackLink& incoming)
+            : _outgoing(outgoing)
+            , _incoming(incoming)
+        {
+        }
+
+        SocketStatus getStatus() const override { return SocketStatus::connected; }
+        const char* getError() const override { return nullptr; }
+        const char* getHostName() const override { return "loopback"; }
+        Protocol getProtocol() const override { return Protocol::ipv4; }
+        std::string getIpAddress() const override { return "loopback"; }
+
+        void listen(Protocol, uint16_t) override {}
+        void listen(Protocol, const std::string&, uint16_t) override {}
+
+        size_t sendData(Protocol, const std::string&, uint16_t, const void* buffer, size_t size) override
+        {
+            _outgoing.send(buffer, size);
+            return size;
+        }
+
+        size_t sendData(const INetworkEndpoint&, const void* buffer, size_t size) override
+        {
+            _outgoing.send(buffer, size);
+            return size;
+        }
+
+        NetworkReadPacket receiveData(void* buffer, size_t size, size_t* sizeReceived, std::unique_ptr<INetworkEndpoint>* sender) override
+        {
+            if (!_incoming.receive(buffer, size, sizeReceived))
+            {
+                return NetworkReadPacket::noData;
+            }
+            if (sender != nullptr)
+            {
+                *sender = std::make_unique<LoopbackEndpoint>();
+            }
+            return NetworkReadPacket::success;
+        }
+
+        void close() override {}
+    };
+
+    // Mirrors NetworkBase::receivePacketLoop and the game loop update for one connection
+    static void pollConnection(IUdpSocket& socket, NetworkConnection& connection, bool update)
+    {
+        Packet packet;
+        size_t packetSize{};
+        while (socket.receiveData(&packet, sizeof(Packet), &packetSize, nullptr) == NetworkReadPacket::success)
+        {
+            if (packetSize >= sizeof(PacketHeader) && packet.header.dataSize <= packetSize - sizeof(PacketHeader))
+            {
+                connection.receivePacket(packet);
+            }
+        }
+        if (update)
+        {
+            connection.update();
+        }
+    }
+
+    Results run(const Options& options)
+    {
+        Results results;
+
+        LoopbackLink serverToClient(options, 1);
+        LoopbackLink clientToServer(options, 2);
+        LoopbackSocket serverSocket(serverToClient, clientToServer);
+        LoopbackSocket clientSocket(clientToServer, serverToClient);
+        NetworkConnection server(&serverSocket, std::make_unique<LoopbackEndpoint>());
+        NetworkConnection client(&clientSocket, std::make_unique<LoopbackEndpoint>());
+
+        uint32_t lastUpdate{};
+        const auto poll = [&]() {
+            const auto now = Platform::getTime();
+            const bool update = now - lastUpdate >= kUpdateInterval;
+            if (update)
+            {
+                lastUpdate = now;
+            }
+            pollConnection(serverSocket, server, update);
+            pollConnection(clientSocket, client, update);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        };
+
+        // State transfer, sent the same way as NetworkServer::onReceiveStateRequestPacket
+        constexpr uint32_t kChunkSize = 4000;
+        const auto numChunks = (options.stateSize + kChunkSize - 1) / kChunkSize;
+        const auto transferStart = Platform::getTime();
+        for (uint32_t index = 0; index < numChunks; index++)
+        {
+            RequestStateResponseChunk chunk;
+            chunk.index = static_cast<uint16_t>(index);
+            chunk.offset = index * kChunkSize;
+            chunk.dataSize = std::min(kChunkSize, options.stateSize - chunk.offset);
+            server.sendPacket(chunk);
+        }
+
+        uint32_t chunksReceived = 0;
+        while (chunksReceived < numChunks && Platform::getTime() - transferStart < kTimeout)
+        {
+            poll();
+            while (auto packet = client.takeNextPacket())
+            {
+                if (packet->header.kind == PacketKind::requestStateResponseChunk)
+                {
+                    chunksReceived++;
+                }
+            }
+        }
+        results.stateTransferComplete = chunksReceived == numChunks;
+        results.stateTransferTime = Platform::getTime() - transferStart;
+
+        // Game commands, sent by the client once per update and timed until the server takes them
+        std::vector<uint32_t> sendTimes(options.numGameCommands);
+        std::vector<uint32_t> latencies;
+        uint32_t numSent = 0;
+        const auto commandsStart = Platform::getTime();
+        uint32_t lastCommand{};
+        while (latencies.size() < options.numGameCommands && Platform::getTime() - commandsStart < kTimeout)
+        {
+            const auto now = Platform::getTime();
+            if (numSent < options.numGameCommands && now - lastCommand >= kUpdateInterval)
+            {
+                lastCommand = now;
+                GameCommandPacket packet;
+                packet.index = numSent;
+                sendTimes[numSent++] = now;
+                client.sendPacket(packet);
+            }
+
+            poll();
+            while (auto packet = server.takeNextPacket())
+            {
+                if (auto* command = packet->as<PacketKind::gameCommand, GameCommandPacket>(); command != nullptr && command->index < numSent)
+                {
+                    latencies.push_back(Platform::getTime() - sendTimes[command->index]);
+                }
+            }
+        }
+
+        results.gameCommandsReceived = static_cast<uint32_t>(latencies.size());
+        if (!latencies.empty())
+        {
+            std::sort(latencies.begin(), latencies.end());
+            results.gameCommandLatencyMean = std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+            results.gameCommandLatencyP99 = latencies[std::min(latencies.size() - 1, latencies.size() * 99 / 100)];
+            results.gameCommandLatencyMax = latencies.back();
+        }
+
+        results.datagramsDropped = serverToClient.getDropped() + clientToServer.getDropped();
+        results.server = server.getStatistics();
+        results.client = client.getStatistics();
+        return results;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "NetworkConnection.h"
+#include <cstdint>
+
+namespace OpenLoco::Network::LoopbackBenchmark
+{
+    struct Options
+    {
+        uint32_t packetLoss{};         // Percentage of datagrams dropped in each direction
+        uint32_t latency = 25;         // One way delay in milliseconds
+        uint32_t bandwidth = 4096;     // Bytes per millisecond the link can carry before it queues
+        uint32_t stateSize = 0x200000; // Bytes of state sent from the server to the client
+        uint32_t numGameCommands = 100;
+    };
+
+    struct Results
+    {
+        bool stateTransferComplete{};
+        uint32_t stateTransferTime{}; // Milliseconds
+        uint32_t gameCommandsReceived{};
+        double gameCommandLatencyMean{};
+        uint32_t gameCommandLatencyP99{};
+        uint32_t gameCommandLatencyMax{};
+        uint32_t datagramsDropped{};
+        ConnectionStatistics server;
+        ConnectionStatistics client;
+    };
+
+    // Runs a server and client connection against each other over an in-process link that simulates
+    // latency, limited bandwidth and packet loss. Takes real time as the connections use wall clock timers.
+    Results run(const Options& options);
+}
@@ -164,6 +164,21 @@ namespace OpenLoco::Network
         }
     }
 
+    void processTickEnd(uint32_t tick)
+    {
+        switch (_mode)
+        {
+            case NetworkMode::none:
+                break;
+            case NetworkMode::server:
+                _server->sendStateChecksum(tick);
+                break;
+            case NetworkMode::client:
+                _client->sendStateChecksum(tick);
+                break;
+        }
+    }
+
     bool isConnected()
     {
         switch (_mode)
@@ -16,7 +16,7 @@ namespace OpenLoco::Network
 
     constexpr port_t kDefaultPort = 11754;
     constexpr uint16_t kMaxPacketSize = 4096;
-    constexpr uint16_t kNetworkVersion = 1;
+    constexpr uint16_t kNetworkVersion = 4;
 
     void openServer();
     void joinServer(std::string_view host);
@@ -31,6 +31,11 @@ namespace OpenLoco::Network
     bool shouldProcessTick(uint32_t tick);
     void processGameCommands(uint32_t tick);
 
+    /**
+     * Exchanges a checksum of the game state after the tick has been processed.
+     */
+    void processTickEnd(uint32_t tick);
+
     /**
      * Whether the game state is networked.
      * This will return false if the client is still receiving the map from the server.
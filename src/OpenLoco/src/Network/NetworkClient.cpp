@@ -5,6 +5,7 @@
 #include "NetworkConnection.h"
 #include "S5/S5.h"
 #include "SceneManager.h"
+#include "StateTransfer.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/BinaryStream.h>
 #include <OpenLoco/Platform/Platform.h>
@@ -13,6 +14,13 @@ using namespace OpenLoco;
 using namespace OpenLoco::Network;
 using namespace OpenLoco::Diagnostics;
 
+// Last state received from a server, kept across connections so that reconnecting only transfers what changed
+static uint32_t _stateBaselineId{};
+static std::vector<uint8_t> _stateBaseline;
+
+// Far larger than any game state, stops malformed responses from forcing huge allocations
+constexpr uint32_t kMaxRequestStateSize = 64 * 1024 * 1024;
+
 NetworkClient::~NetworkClient()
 {
     close();
@@ -174,6 +182,9 @@ void NetworkClient::onReceivePacketFromServer(const Packet& packet)
         case PacketKind::gameCommand:
             receiveGameCommandPacket(*reinterpret_cast<const GameCommandPacket*>(packet.data));
             break;
+        case PacketKind::stateChecksum:
+            receiveStateChecksumPacket(*reinterpret_cast<const StateChecksumPacket*>(packet.data));
+            break;
         default:
             break;
     }
@@ -191,10 +202,15 @@ void NetworkClient::sendConnectPacket()
 void NetworkClient::sendRequestStatePacket()
 {
     _requestStateCookie = (std::rand() << 16) | std::rand();
+    _requestStateResponseReceived = false;
+    _requestStatePayload.clear();
     _requestStateChunksReceived.clear();
+    _requestStateReceivedBytes = 0;
+    _requestStateReceivedChunks = 0;
 
     RequestStatePacket packet;
     packet.cookie = _requestStateCookie;
+    packet.baselineId = _stateBaselineId;
     _serverConnection->sendPacket(packet);
 }
 
@@ -214,49 +230,108 @@ void NetworkClient::receiveConnectionResponsePacket(const ConnectResponsePacket&
 
 void NetworkClient::receiveRequestStateResponsePacket(const RequestStateResponse& response)
 {
-    if (response.cookie == _requestStateCookie)
+    if (response.cookie == _requestStateCookie && !_requestStateResponseReceived)
     {
-        _requestStateNumChunks = response.numChunks;
-        _requestStateTotalSize = response.totalSize;
-        _requestStateReceivedChunks = 0;
+        // Chunks received early must also fit within what the response announces
+        if (response.totalSize > kMaxRequestStateSize || response.stateSize > kMaxRequestStateSize
+            || _requestStatePayload.size() > response.totalSize || _requestStateChunksReceived.size() > response.numChunks)
+        {
+            Logging::error("Received invalid state response.");
+            close();
+            return;
+        }
+
+        _requestStateResponseReceived = true;
+        _requestStateResponse = response;
+        _requestStatePayload.resize(response.totalSize);
+        _requestStateChunksReceived.resize(response.numChunks);
+        tryCompleteRequestState();
     }
 }
 
 void NetworkClient::receiveRequestStateResponseChunkPacket(const RequestStateResponseChunk& responseChunk)
 {
-    if (responseChunk.cookie == _requestStateCookie)
+    if (responseChunk.cookie != _requestStateCookie || responseChunk.dataSize > sizeof(responseChunk.data))
     {
-        if (_requestStateChunksReceived.size() <= responseChunk.index)
-        {
-            _requestStateChunksReceived.resize(responseChunk.index + 1);
-        }
+        return;
+    }
 
-        auto& rchunk = _requestStateChunksReceived[responseChunk.index];
-        if (rchunk.data.size() == 0)
-        {
-            rchunk.offset = responseChunk.offset;
-            rchunk.data.assign(responseChunk.data, responseChunk.data + responseChunk.dataSize);
-            _requestStateReceivedChunks++;
+    // Chunks can arrive before the response that describes them, only the size cap can be checked until then
+    const auto end = static_cast<size_t>(responseChunk.offset) + responseChunk.dataSize;
+    const auto maxSize = _requestStateResponseReceived ? _requestStateResponse.totalSize : kMaxRequestStateSize;
+    if (end > maxSize || (_requestStateResponseReceived && responseChunk.index >= _requestStateResponse.numChunks))
+    {
+        Logging::error("Received invalid state chunk.");
+        return;
+    }
 
-            _requestStateReceivedBytes += responseChunk.dataSize;
-            setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateTotalSize));
-        }
+    if (_requestStateChunksReceived.size() <= responseChunk.index)
+    {
+        _requestStateChunksReceived.resize(responseChunk.index + 1);
+    }
+    if (_requestStatePayload.size() < end)
+    {
+        _requestStatePayload.resize(end);
+    }
 
-        if (_requestStateReceivedChunks >= _requestStateNumChunks)
-        {
-            // Construct full data
-            std::vector<uint8_t> fullData;
-            for (size_t i = 0; i < _requestStateChunksReceived.size(); i++)
-            {
-                fullData.insert(fullData.end(), _requestStateChunksReceived[i].data.begin(), _requestStateChunksReceived[i].data.end());
-            }
+    if (!_requestStateChunksReceived[responseChunk.index])
+    {
+        _requestStateChunksReceived[responseChunk.index] = true;
+        std::memcpy(_requestStatePayload.data() + responseChunk.offset, responseChunk.data, responseChunk.dataSize);
+        _requestStateReceivedChunks++;
 
-            clearStatus();
-            _status = NetworkClientStatus::connected;
+        _requestStateReceivedBytes += responseChunk.dataSize;
+        setStatus("Receiving state: " + std::to_string(_requestStateReceivedBytes) + " / " + std::to_string(_requestStateResponse.totalSize));
+    }
 
-            processFullState(fullData);
-        }
+    tryCompleteRequestState();
+}
+
+void NetworkClient::tryCompleteRequestState()
+{
+    if (!_requestStateResponseReceived || _requestStateReceivedChunks < _requestStateResponse.numChunks)
+    {
+        return;
+    }
+
+    const auto& response = _requestStateResponse;
+    if (response.baselineId != 0 && response.baselineId != _stateBaselineId)
+    {
+        Logging::error("Received state was encoded against an unknown baseline.");
+        close();
+        return;
     }
+
+    std::vector<uint8_t> fullData;
+    try
+    {
+        auto payload = std::span<const uint8_t>(_requestStatePayload.data(), response.totalSize);
+        auto baseline = response.baselineId != 0 ? std::span<const uint8_t>(_stateBaseline) : std::span<const uint8_t>();
+        fullData = StateTransfer::decode(payload, baseline, response.stateSize);
+    }
+    catch (const std::exception& e)
+    {
+        Logging::error("Unable to decode received state: {}", e.what());
+        close();
+        return;
+    }
+
+    if (fullData.size() < sizeof(ExtraState))
+    {
+        Logging::error("Received state is too small.");
+        close();
+        return;
+    }
+
+    clearStatus();
+    _status = NetworkClientStatus::connected;
+
+    _stateBaselineId = response.stateId;
+    _stateBaseline = fullData;
+    _requestStatePayload.clear();
+    _requestStateChunksReceived.clear();
+
+    processFullState(_stateBaseline);
 }
 
 void NetworkClient::processFullState(std::span<uint8_t const> fullData)
@@ -268,6 +343,11 @@ void NetworkClient::processFullState(std::span<uint8_t const> fullData)
 
     BinaryStream bs(fullData.data(), fullData.size() - sizeof(ExtraState));
     S5::importSaveToGameState(bs, S5::LoadFlags::none);
+
+    // Checksums from before the state was received no longer apply
+    _localChecksums.clear();
+    _serverChecksums.clear();
+    _hasDesynced = false;
 }
 
 void NetworkClient::receiveChatMessagePacket(const ReceiveChatMessage& packet)
@@ -319,6 +399,44 @@ void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
     updateLocalTick();
 }
 
+void NetworkClient::receiveStateChecksumPacket(const StateChecksumPacket& packet)
+{
+    if (_status != NetworkClientStatus::connected)
+        return;
+
+    _serverChecksums.add(packet.tick, packet.checksums);
+    compareStateChecksums(packet.tick);
+}
+
+void NetworkClient::sendStateChecksum(uint32_t tick)
+{
+    if (_serverConnection == nullptr || _status != NetworkClientStatus::connected)
+        return;
+
+    StateChecksumPacket packet;
+    packet.tick = tick;
+    packet.checksums = GameStateChecksum::compute(tick);
+    _localChecksums.add(tick, packet.checksums);
+    _serverConnection->sendPacket(packet);
+
+    compareStateChecksums(tick);
+}
+
+// The server's checksums usually arrive before the tick is processed locally but can arrive after it
+void NetworkClient::compareStateChecksums(uint32_t tick)
+{
+    const auto* localChecksums = _localChecksums.find(tick);
+    const auto* serverChecksums = _serverChecksums.find(tick);
+    if (localChecksums == nullptr || serverChecksums == nullptr || _hasDesynced)
+        return;
+
+    if (auto subsystem = GameStateChecksum::findFirstDivergence(*serverChecksums, *localChecksums))
+    {
+        _hasDesynced = true;
+        Logging::error("Desynced from server at tick {}, first diverging subsystem: {}", tick, GameStateChecksum::getSubsystemName(*subsystem));
+    }
+}
+
 void NetworkClient::sendChatMessage(std::string_view message)
 {
     if (_serverConnection != nullptr)
@@ -35,23 +35,23 @@ namespace OpenLoco::Network
         uint32_t _serverTick;
         std::list<GameCommandPacket> _receivedGameCommands;
 
-        struct ReceivedChunk
-        {
-            uint32_t offset{};
-            std::vector<uint8_t> data;
-        };
-
         uint32_t _requestStateCookie{};
-        uint32_t _requestStateTotalSize{};
-        uint16_t _requestStateNumChunks{};
-        std::vector<ReceivedChunk> _requestStateChunksReceived;
+        bool _requestStateResponseReceived{};
+        RequestStateResponse _requestStateResponse;
+        std::vector<uint8_t> _requestStatePayload;
+        std::vector<bool> _requestStateChunksReceived;
         uint32_t _requestStateReceivedBytes{};
         uint32_t _requestStateReceivedChunks{};
 
+        GameStateChecksum::History _localChecksums;
+        GameStateChecksum::History _serverChecksums;
+        bool _hasDesynced{};
+
         void onCancel();
         void processReceivedPackets();
         bool hasTimedOut() const;
         void onReceivePacketFromServer(const Packet& packet);
+        void tryCompleteRequestState();
         void processFullState(std::span<uint8_t const> data);
         void updateLocalTick();
 
@@ -69,6 +69,8 @@ namespace OpenLoco::Network
         void receiveChatMessagePacket(const ReceiveChatMessage& packet);
         void receivePingPacket(const PingPacket& packet);
         void receiveGameCommandPacket(const GameCommandPacket& packet);
+        void receiveStateChecksumPacket(const StateChecksumPacket& packet);
+        void compareStateChecksums(uint32_t tick);
 
     protected:
         void onClose() override;
@@ -87,5 +89,6 @@ namespace OpenLoco::Network
 
         bool shouldProcessTick(uint32_t tick) const;
         void runGameCommandsForTick(uint32_t tick);
+        void sendStateChecksum(uint32_t tick);
     };
 }
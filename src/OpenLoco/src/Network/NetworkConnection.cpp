@@ -1,16 +1,49 @@
 #include "NetworkConnection.h"
 #include "Logging.h"
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 using namespace OpenLoco::Network;
 
-constexpr uint32_t kRedeliverTimeout = 1000;
 constexpr uint32_t kConnectionTimeout = 15000;
 
+// Retransmission timeout before a round trip has been measured and its bounds afterwards
+constexpr uint32_t kInitialRetransmitTimeout = 1000;
+constexpr uint32_t kMinRetransmitTimeout = 100;
+constexpr uint32_t kMaxRetransmitTimeout = 4000;
+
+// Congestion window in packets, the maximum stays well below the number of received sequences remembered
+constexpr float kInitialWindow = 16;
+constexpr float kMinWindow = 4;
+constexpr float kMaxWindow = 256;
+constexpr float kMaxPacingBurst = 8;
+
+// Round trips this much above the lowest seen mean packets are queueing somewhere along the path
+constexpr uint32_t kMinQueueingDelay = 10;
+
+// A packet is resent early once this many packets sent after it have been acknowledged
+constexpr uint8_t kFastResendThreshold = 3;
+
+// Acknowledgements are held back until this many are pending or the oldest has waited this long
+constexpr size_t kMaxPendingAcks = 16;
+constexpr uint32_t kMaxAckDelay = 10;
+
+constexpr size_t kReceivedSequenceHistory = 1024;
+
+static bool isSequenceAfter(sequence_t a, sequence_t b)
+{
+    return static_cast<int16_t>(a - b) > 0;
+}
+
 NetworkConnection::NetworkConnection(IUdpSocket* socket, std::unique_ptr<INetworkEndpoint> endpoint)
     : _socket(socket)
     , _endpoint(std::move(endpoint))
+    , _window(kInitialWindow)
+    , _slowStartThreshold(kMaxWindow)
+    , _pacingCredit(kInitialWindow)
+    , _retransmitTimeout(kInitialRetransmitTimeout)
 {
 }
 
@@ -36,6 +69,7 @@ bool NetworkConnection::hasTimedOut() const
 
 void NetworkConnection::update()
 {
+    sendAcknowledgements();
     resendUndeliveredPackets();
 }
 
@@ -49,9 +83,9 @@ bool NetworkConnection::checkOrRecordReceivedSequence(sequence_t sequence)
         }
     }
 
-    while (_receivedSequences.size() >= 1024)
+    while (_receivedSequences.size() >= kReceivedSequenceHistory)
     {
-        _receivedSequences.pop_back();
+        _receivedSequences.pop_front();
     }
 
     _receivedSequences.push_back(sequence);
@@ -65,13 +99,13 @@ void NetworkConnection::receivePacket(const Packet& packet)
     logPacket(packet, false, false);
     if (packet.header.kind == PacketKind::ack)
     {
-        receiveAcknowledgePacket(packet.header.sequence);
+        receiveAcknowledgePacket(packet);
     }
     else
     {
         // Send ACK back, even if we have already received this packet before
         // the ACK we sent before, may not have been delivered successfully
-        sendAcknowledgePacket(packet.header.sequence);
+        queueAcknowledgement(packet.header.sequence);
 
         // Only store the packet, if this is the first time we received it
         if (!checkOrRecordReceivedSequence(packet.header.sequence))
@@ -97,58 +131,277 @@ void NetworkConnection::sendPacket(PacketKind kind, size_t dataSize, const void*
 
 void NetworkConnection::sendPacket(const Packet& packet)
 {
-    if (packet.header.kind != PacketKind::ack)
+    if (packet.header.kind == PacketKind::ack)
+    {
+        size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
+        _socket->sendData(*_endpoint, &packet, packetSize);
+        logPacket(packet, true, false);
+        return;
+    }
+
+    // Packets wait in the queue until the window and pacing allow them to be sent
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    _queuedPackets.push_back(packet);
+    transmitQueuedPackets(getTime());
+}
+
+void NetworkConnection::transmitQueuedPackets(uint32_t now)
+{
+    // Spread a window worth of packets across a round trip instead of sending it in one burst
+    const auto elapsed = now - _timeOfLastTransmit;
+    _timeOfLastTransmit = now;
+    if (_smoothedRtt == 0)
     {
-        std::unique_lock<std::mutex> lk(_sentPacketsSync);
-        auto timestamp = getTime();
-        _sentPackets.push_back({ timestamp, packet });
+        _pacingCredit = _window;
     }
+    else
+    {
+        const auto maxCredit = std::max(kMaxPacingBurst, _window / 4);
+        _pacingCredit = std::min(_pacingCredit + elapsed * _window / _smoothedRtt, maxCredit);
+    }
+
+    while (!_queuedPackets.empty() && _sentPackets.size() < static_cast<size_t>(_window) && _pacingCredit >= 1)
+    {
+        const auto& packet = _queuedPackets.front();
+        size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
+        _socket->sendData(*_endpoint, &packet, packetSize);
+        logPacket(packet, true, false);
 
-    size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
-    _socket->sendData(*_endpoint, &packet, packetSize);
-    logPacket(packet, true, false);
+        _sentPackets.push_back({ now, 1, 0, packet });
+        _queuedPackets.pop_front();
+        _pacingCredit--;
+        _statistics.packetsSent++;
+    }
 }
 
-void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
+void NetworkConnection::receiveAcknowledgePacket(const Packet& packet)
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    auto now = getTime();
+
+    // Packets newly acknowledged by this ack, packets still in flight that were sent before several of them
+    // have most likely been lost
+    std::array<std::pair<uint32_t, sequence_t>, 33> acknowledged;
+    size_t numAcknowledged = 0;
+    const auto acknowledge = [&](sequence_t sequence) {
+        const auto timestamp = acknowledgeSentPacket(sequence, now);
+        if (timestamp)
+        {
+            acknowledged[numAcknowledged++] = std::make_pair(*timestamp, sequence);
+        }
+    };
+
+    acknowledge(packet.header.sequence);
+    if (auto* ack = packet.as<PacketKind::ack, AckPacket>())
     {
-        if (_sentPackets[i].packet.header.sequence == sequence)
+        for (uint32_t i = 0; i < 32; i++)
         {
-            _sentPackets.erase(_sentPackets.begin() + i);
-            break;
+            if (ack->bits & (1U << i))
+            {
+                acknowledge(static_cast<sequence_t>(packet.header.sequence - 1 - i));
+            }
         }
     }
+    if (numAcknowledged == 0)
+    {
+        return;
+    }
+
+    for (auto& sentPacket : _sentPackets)
+    {
+        uint32_t laterAcks = 0;
+        for (size_t i = 0; i < numAcknowledged; i++)
+        {
+            const auto [timestamp, sequence] = acknowledged[i];
+            if (timestamp > sentPacket.timestamp || (timestamp == sentPacket.timestamp && isSequenceAfter(sequence, sentPacket.packet.header.sequence)))
+            {
+                laterAcks++;
+            }
+        }
+        if (laterAcks == 0)
+        {
+            continue;
+        }
+
+        sentPacket.laterAcks = static_cast<uint8_t>(std::min<uint32_t>(sentPacket.laterAcks + laterAcks, kFastResendThreshold));
+        if (sentPacket.laterAcks >= kFastResendThreshold)
+        {
+            resendPacket(sentPacket, now);
+            reduceWindow(now);
+        }
+    }
+
+    transmitQueuedPackets(now);
 }
 
-void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
+std::optional<uint32_t> NetworkConnection::acknowledgeSentPacket(sequence_t sequence, uint32_t now)
 {
-    Packet packet;
-    packet.header.kind = PacketKind::ack;
-    packet.header.sequence = sequence;
-    packet.header.dataSize = 0;
-    sendPacket(packet);
+    auto it = std::find_if(_sentPackets.begin(), _sentPackets.end(), [sequence](const SentPacket& sentPacket) {
+        return sentPacket.packet.header.sequence == sequence;
+    });
+    if (it == _sentPackets.end())
+    {
+        return std::nullopt;
+    }
+
+    // Only packets sent once give an unambiguous round trip time
+    if (it->sendCount == 1)
+    {
+        const auto rtt = now - it->timestamp;
+        _minRtt = std::min(_minRtt, rtt);
+        if (_smoothedRtt == 0)
+        {
+            _smoothedRtt = std::max<uint32_t>(rtt, 1);
+            _rttVariance = rtt / 2;
+        }
+        else
+        {
+            const auto deviation = rtt > _smoothedRtt ? rtt - _smoothedRtt : _smoothedRtt - rtt;
+            _rttVariance = (3 * _rttVariance + deviation) / 4;
+            _smoothedRtt = std::max<uint32_t>((7 * _smoothedRtt + rtt) / 8, 1);
+        }
+        // Allow for the receiver holding back its acknowledgements
+        _retransmitTimeout = std::clamp(_smoothedRtt + 4 * _rttVariance + kMaxAckDelay, kMinRetransmitTimeout, kMaxRetransmitTimeout);
+    }
+
+    const auto timestamp = it->timestamp;
+    _sentPackets.erase(it);
+
+    if (isCongested())
+    {
+        return timestamp;
+    }
+    if (_window < _slowStartThreshold)
+    {
+        _window += 1;
+    }
+    else
+    {
+        _window += 1 / _window;
+    }
+    _window = std::min(_window, kMaxWindow);
+    return timestamp;
+}
+
+bool NetworkConnection::isCongested() const
+{
+    return _smoothedRtt != 0 && _smoothedRtt > _minRtt + std::max(_minRtt / 2, kMinQueueingDelay);
+}
+
+void NetworkConnection::reduceWindow(uint32_t now)
+{
+    // Losses without a rise in round trip time are random rather than the path being overloaded, so the
+    // packet is only resent. Losses within the same round trip are treated as a single congestion event.
+    if (!isCongested() || now - _timeOfLastWindowReduction < std::max(_smoothedRtt, kMinRetransmitTimeout))
+    {
+        return;
+    }
+    _timeOfLastWindowReduction = now;
+    _slowStartThreshold = std::max(_window / 2, kMinWindow);
+    _window = _slowStartThreshold;
+}
+
+void NetworkConnection::queueAcknowledgement(sequence_t sequence)
+{
+    bool shouldSend{};
+    {
+        std::unique_lock<std::mutex> lk(_pendingAcksSync);
+        auto now = getTime();
+        if (_pendingAcks.empty())
+        {
+            _timeOfOldestPendingAck = now;
+        }
+        _pendingAcks.push_back(sequence);
+        shouldSend = _pendingAcks.size() >= kMaxPendingAcks || now - _timeOfOldestPendingAck >= kMaxAckDelay;
+    }
+    if (shouldSend)
+    {
+        sendAcknowledgements();
+    }
+}
+
+void NetworkConnection::sendAcknowledgements()
+{
+    std::vector<sequence_t> sequences;
+    {
+        std::unique_lock<std::mutex> lk(_pendingAcksSync);
+        if (_pendingAcks.empty())
+        {
+            return;
+        }
+        sequences.swap(_pendingAcks);
+    }
+
+    // Each packet acknowledges a sequence and the 32 before it, grouped from the newest sequence down
+    std::sort(sequences.begin(), sequences.end(), [](sequence_t a, sequence_t b) { return isSequenceAfter(a, b); });
+    sequences.erase(std::unique(sequences.begin(), sequences.end()), sequences.end());
+
+    std::vector<Packet> packets;
+    size_t i = 0;
+    while (i < sequences.size())
+    {
+        auto& packet = packets.emplace_back();
+        packet.header.kind = PacketKind::ack;
+        packet.header.sequence = sequences[i++];
+        packet.header.dataSize = sizeof(AckPacket);
+
+        AckPacket ack;
+        for (; i < sequences.size(); i++)
+        {
+            const auto distance = static_cast<sequence_t>(packet.header.sequence - sequences[i]);
+            if (distance > 32)
+            {
+                break;
+            }
+            ack.bits |= 1U << (distance - 1);
+        }
+        std::memcpy(packet.data, &ack, sizeof(ack));
+    }
+
+    // Oldest first so the sender does not take packets acknowledged in a later packet as lost
+    for (auto it = packets.rbegin(); it != packets.rend(); it++)
+    {
+        sendPacket(*it);
+    }
+
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    _statistics.acksSent += static_cast<uint32_t>(packets.size());
 }
 
 void NetworkConnection::resendUndeliveredPackets()
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
     auto now = getTime();
-    auto timestamp = now - kRedeliverTimeout;
 
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    bool hasTimedOut{};
+    for (auto& sentPacket : _sentPackets)
     {
-        auto& sentPacket = _sentPackets[i];
-        if (sentPacket.timestamp < timestamp)
+        if (now - sentPacket.timestamp >= _retransmitTimeout)
         {
-            size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
-            _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
-            logPacket(sentPacket.packet, true, true);
-
-            sentPacket.timestamp = now;
+            resendPacket(sentPacket, now);
+            hasTimedOut = true;
         }
     }
+
+    if (hasTimedOut)
+    {
+        reduceWindow(now);
+        _retransmitTimeout = std::min(_retransmitTimeout * 2, kMaxRetransmitTimeout);
+    }
+
+    transmitQueuedPackets(now);
+}
+
+void NetworkConnection::resendPacket(SentPacket& sentPacket, uint32_t now)
+{
+    size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
+    _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
+    logPacket(sentPacket.packet, true, true);
+
+    sentPacket.timestamp = now;
+    sentPacket.sendCount = static_cast<uint8_t>(std::min(sentPacket.sendCount + 1, 255));
+    sentPacket.laterAcks = 0;
+    _statistics.packetsResent++;
 }
 
 std::optional<Packet> NetworkConnection::takeNextPacket()
@@ -163,6 +416,15 @@ std::optional<Packet> NetworkConnection::takeNextPacket()
     return std::nullopt;
 }
 
+ConnectionStatistics NetworkConnection::getStatistics()
+{
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    auto statistics = _statistics;
+    statistics.roundTripTime = _smoothedRtt;
+    statistics.window = static_cast<uint32_t>(_window);
+    return statistics;
+}
+
 [[maybe_unused]] static const char* getPacketKindString(PacketKind kind)
 {
     switch (kind)
@@ -177,6 +439,7 @@ std::optional<Packet> NetworkConnection::takeNextPacket()
         case PacketKind::sendChatMessage: return "SEND CHAT";
         case PacketKind::receiveChatMessage: return "RECEIVE CHAT";
         case PacketKind::gameCommand: return "GAME COMMAND";
+        case PacketKind::stateChecksum: return "STATE CHECKSUM";
         default: return "UNKNOWN";
     }
 }
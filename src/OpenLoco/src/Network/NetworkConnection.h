@@ -6,6 +6,7 @@
 #include <cassert>
 #include <cstdint>
 #include <deque>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -14,12 +15,28 @@
 
 namespace OpenLoco::Network
 {
+    struct ConnectionStatistics
+    {
+        uint32_t packetsSent{};
+        uint32_t packetsResent{};
+        uint32_t acksSent{};
+        uint32_t roundTripTime{}; // Smoothed, in milliseconds
+        uint32_t window{};        // Packets allowed in flight
+    };
+
+    /**
+     * Reliable delivery over UDP. Packets are sent within a congestion window and paced across the round trip
+     * time, received packets are acknowledged in batches and a packet is resent once its retransmission
+     * timeout expires or when enough packets sent after it have been acknowledged.
+     */
     class NetworkConnection
     {
     private:
         struct SentPacket
         {
             uint32_t timestamp;
+            uint8_t sendCount;
+            uint8_t laterAcks; // Acknowledgements received for packets sent after this one since it was last sent
             Packet packet;
         };
 
@@ -27,17 +44,39 @@ namespace OpenLoco::Network
         std::unique_ptr<INetworkEndpoint> _endpoint;
         std::mutex _sentPacketsSync;
         std::mutex _receivedPacketsSync;
+        std::mutex _pendingAcksSync;
         std::vector<SentPacket> _sentPackets;
+        std::deque<Packet> _queuedPackets;
         std::queue<Packet> _receivedPackets;
         std::deque<sequence_t> _receivedSequences;
+        std::vector<sequence_t> _pendingAcks;
+        uint32_t _timeOfOldestPendingAck{};
         uint16_t _sendSequence{};
         uint32_t _timeOfLastReceivedPacket{};
 
+        // Congestion control, guarded by _sentPacketsSync
+        float _window;
+        float _slowStartThreshold;
+        float _pacingCredit{};
+        uint32_t _timeOfLastTransmit{};
+        uint32_t _timeOfLastWindowReduction{};
+        uint32_t _smoothedRtt{};
+        uint32_t _rttVariance{};
+        uint32_t _minRtt = std::numeric_limits<uint32_t>::max();
+        uint32_t _retransmitTimeout;
+        ConnectionStatistics _statistics{};
+
         static uint32_t getTime();
         bool checkOrRecordReceivedSequence(sequence_t sequence);
-        void receiveAcknowledgePacket(sequence_t sequence);
-        void sendAcknowledgePacket(sequence_t sequence);
+        void receiveAcknowledgePacket(const Packet& packet);
+        std::optional<uint32_t> acknowledgeSentPacket(sequence_t sequence, uint32_t now);
+        void queueAcknowledgement(sequence_t sequence);
+        void sendAcknowledgements();
         void resendUndeliveredPackets();
+        void resendPacket(SentPacket& sentPacket, uint32_t now);
+        bool isCongested() const;
+        void reduceWindow(uint32_t now);
+        void transmitQueuedPackets(uint32_t now);
         void sendPacket(PacketKind kind, size_t dataSize, const void* packetData);
         void logPacket(const Packet& packet, bool sent, bool resend);
 
@@ -50,6 +89,7 @@ namespace OpenLoco::Network
         void receivePacket(const Packet& packet);
         void sendPacket(const Packet& packet);
         std::optional<Packet> takeNextPacket();
+        ConnectionStatistics getStatistics();
 
         template<typename T>
         void sendPacket(const T& packetData)
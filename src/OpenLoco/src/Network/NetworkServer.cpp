@@ -6,6 +6,7 @@
 #include "S5/S5.h"
 #include "ScenarioManager.h"
 #include "SceneManager.h"
+#include "StateTransfer.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/MemoryStream.h>
 #include <OpenLoco/Platform/Platform.h>
@@ -139,6 +140,9 @@ void NetworkServer::onReceivePacketFromClient(Client& client, const Packet& pack
         case PacketKind::gameCommand:
             onReceiveGameCommandPacket(client, *packet.cast<GameCommandPacket>());
             break;
+        case PacketKind::stateChecksum:
+            onReceiveStateChecksumPacket(client, *packet.cast<StateChecksumPacket>());
+            break;
         default:
             break;
     }
@@ -148,9 +152,9 @@ void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestSta
 {
     constexpr uint16_t kChunkSize = 4000;
 
-    // Dump S5 data to stream
+    // Dump S5 data to stream, uncompressed so that unchanged blocks match the baseline
     MemoryStream ms;
-    S5::exportGameStateToFile(ms, S5::SaveFlags::noWindowClose);
+    S5::exportGameStateToFile(ms, S5::SaveFlags::noWindowClose | S5::SaveFlags::uncompressed);
 
     // Append extra state
     ExtraState extra;
@@ -158,12 +162,23 @@ void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestSta
     extra.tick = ScenarioManager::getScenarioTicks();
     ms.write(&extra, sizeof(extra));
 
+    const auto state = std::span<const uint8_t>(reinterpret_cast<const uint8_t*>(ms.data()), ms.getLength());
+
+    // Only send the blocks that changed if the client still has the state we last sent
+    const bool hasBaseline = request.baselineId != 0 && request.baselineId == _stateBaselineId;
+    const auto payload = StateTransfer::encode(state, hasBaseline ? std::span<const uint8_t>(_stateBaseline) : std::span<const uint8_t>());
+
     RequestStateResponse response;
     response.cookie = request.cookie;
-    response.totalSize = ms.getLength();
-    response.numChunks = static_cast<uint16_t>((ms.getLength() + (kChunkSize - 1)) / kChunkSize);
+    response.stateId = ((std::rand() << 16) | std::rand()) | 1;
+    response.baselineId = hasBaseline ? request.baselineId : 0;
+    response.stateSize = static_cast<uint32_t>(state.size());
+    response.totalSize = static_cast<uint32_t>(payload.size());
+    response.numChunks = static_cast<uint16_t>((payload.size() + (kChunkSize - 1)) / kChunkSize);
     client.connection->sendPacket(response);
 
+    Logging::verbose("Sending state: {} bytes encoded from {} bytes", payload.size(), state.size());
+
     uint32_t offset = 0;
     uint32_t remaining = response.totalSize;
     uint16_t index = 0;
@@ -174,13 +189,16 @@ void NetworkServer::onReceiveStateRequestPacket(Client& client, const RequestSta
         chunk.index = index;
         chunk.offset = offset;
         chunk.dataSize = std::min<uint32_t>(kChunkSize, remaining - offset);
-        std::memcpy(chunk.data, reinterpret_cast<const uint8_t*>(ms.data()) + offset, chunk.dataSize);
+        std::memcpy(chunk.data, payload.data() + offset, chunk.dataSize);
 
         client.connection->sendPacket(chunk);
 
         offset += chunk.dataSize;
         index++;
     }
+
+    _stateBaselineId = response.stateId;
+    _stateBaseline.assign(state.begin(), state.end());
 }
 
 void NetworkServer::onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet)
@@ -194,6 +212,35 @@ void NetworkServer::onReceiveGameCommandPacket([[maybe_unused]] Client& client,
     queueGameCommand(packet.company, packet.regs);
 }
 
+void NetworkServer::onReceiveStateChecksumPacket(Client& client, const StateChecksumPacket& packet)
+{
+    const auto* checksums = _stateChecksums.find(packet.tick);
+    if (checksums == nullptr || client.hasDesynced)
+    {
+        return;
+    }
+
+    if (auto subsystem = GameStateChecksum::findFirstDivergence(*checksums, packet.checksums))
+    {
+        client.hasDesynced = true;
+        Logging::error("Client #{} ({}) desynced at tick {}, first diverging subsystem: {}", static_cast<int>(client.id), client.name, packet.tick, GameStateChecksum::getSubsystemName(*subsystem));
+    }
+}
+
+void NetworkServer::sendStateChecksum(uint32_t tick)
+{
+    if (_clients.empty())
+    {
+        return;
+    }
+
+    StateChecksumPacket packet;
+    packet.tick = tick;
+    packet.checksums = GameStateChecksum::compute(tick);
+    _stateChecksums.add(tick, packet.checksums);
+    sendPacketToAll(packet);
+}
+
 void NetworkServer::removedTimedOutClients()
 {
     for (auto it = _clients.begin(); it != _clients.end();)
@@ -15,6 +15,7 @@ namespace OpenLoco::Network
         client_id_t id{};
         std::unique_ptr<NetworkConnection> connection;
         std::string name;
+        bool hasDesynced{};
     };
 
     struct ChatMessage
@@ -37,12 +38,19 @@ namespace OpenLoco::Network
         uint32_t _gameCommandIndex{};
         std::queue<GameCommandPacket> _gameCommands;
 
+        // Last state sent to a client, later requests from that client are encoded against it
+        uint32_t _stateBaselineId{};
+        std::vector<uint8_t> _stateBaseline;
+
+        GameStateChecksum::History _stateChecksums;
+
         Client* findClient(const INetworkEndpoint& endpoint);
         void createNewClient(std::unique_ptr<NetworkConnection> conn, const ConnectPacket& packet);
         void onReceivePacketFromClient(Client& client, const Packet& packet);
         void onReceiveStateRequestPacket(Client& client, const RequestStatePacket& packet);
         void onReceiveSendChatMessagePacket(Client& client, const SendChatMessage& packet);
         void onReceiveGameCommandPacket(Client& client, const GameCommandPacket& packet);
+        void onReceiveStateChecksumPacket(Client& client, const StateChecksumPacket& packet);
         void removedTimedOutClients();
         void sendPings();
         void sendChatMessages();
@@ -73,5 +81,6 @@ namespace OpenLoco::Network
 
         void queueGameCommand(CompanyId company, const OpenLoco::Interop::registers& regs);
         void runGameCommands();
+        void sendStateChecksum(uint32_t tick);
     };
 }
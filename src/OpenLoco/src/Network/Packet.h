@@ -4,6 +4,7 @@
 #include <cstdlib>
 #include <string_view>
 
+#include "GameStateChecksum.h"
 #include "Network.h"
 #include <OpenLoco/Interop/Interop.hpp>
 
@@ -25,6 +26,7 @@ namespace OpenLoco::Network
         sendChatMessage,
         receiveChatMessage,
         gameCommand,
+        stateChecksum,
     };
 
     struct PacketHeader
@@ -58,6 +60,18 @@ namespace OpenLoco::Network
         }
     };
 
+    /**
+     * Acknowledges the sequence in the header along with the 32 sequences before it that are set in bits,
+     * bit 0 being the sequence one before the header sequence.
+     */
+    struct AckPacket
+    {
+        static constexpr PacketKind kind = PacketKind::ack;
+        size_t size() const { return sizeof(AckPacket); }
+
+        uint32_t bits{};
+    };
+
     struct PingPacket
     {
         static constexpr PacketKind kind = PacketKind::ping;
@@ -99,6 +113,7 @@ namespace OpenLoco::Network
         size_t size() const { return sizeof(RequestStatePacket); }
 
         uint32_t cookie{};
+        uint32_t baselineId{}; // State last received from the server, 0 if there is none
     };
 
     struct RequestStateResponse
@@ -107,7 +122,10 @@ namespace OpenLoco::Network
         size_t size() const { return sizeof(RequestStateResponse); }
 
         uint32_t cookie{};
-        uint32_t totalSize{};
+        uint32_t stateId{};    // Baseline id for the next request
+        uint32_t baselineId{}; // State the payload was encoded against, 0 for a full state
+        uint32_t stateSize{};  // Size of the decoded state
+        uint32_t totalSize{};  // Size of the encoded payload
         uint16_t numChunks{};
     };
 
@@ -174,5 +192,17 @@ namespace OpenLoco::Network
         CompanyId company{};
         OpenLoco::Interop::registers regs;
     };
+
+    /**
+     * Game state checksums at the end of a tick, exchanged to detect clients diverging from the server
+     */
+    struct StateChecksumPacket
+    {
+        static constexpr PacketKind kind = PacketKind::stateChecksum;
+        size_t size() const { return sizeof(StateChecksumPacket); }
+
+        uint32_t tick{};
+        GameStateChecksum::Checksums checksums{};
+    };
 #pragma pack(pop)
 }
@@ -0,0 +1,79 @@
+#include "StateTransfer.h"
+#include "S5/SawyerStream.h"
+#include <OpenLoco/Core/BinaryStream.h>
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/MemoryStream.h>
+#include <algorithm>
+#include <cstring>
+
+namespace OpenLoco::Network::StateTransfer
+{
+    // Encoding and length written before every Sawyer chunk
+    constexpr size_t kChunkHeaderSize = sizeof(SawyerEncoding) + sizeof(uint32_t);
+
+    static bool hasBlockChanged(std::span<const uint8_t> state, std::span<const uint8_t> baseline, size_t offset, size_t length)
+    {
+        if (offset + length > baseline.size())
+        {
+            return true;
+        }
+        return std::memcmp(state.data() + offset, baseline.data() + offset, length) != 0;
+    }
+
+    std::vector<uint8_t> encode(std::span<const uint8_t> state, std::span<const uint8_t> baseline)
+    {
+        MemoryStream ms;
+        SawyerStreamWriter writer(ms);
+        MemoryStream blockStream;
+        for (size_t offset = 0; offset < state.size(); offset += kBlockSize)
+        {
+            const auto length = std::min(kBlockSize, state.size() - offset);
+            if (!hasBlockChanged(state, baseline, offset, length))
+            {
+                continue;
+            }
+
+            const auto blockIndex = static_cast<uint32_t>(offset / kBlockSize);
+            writer.write(blockIndex);
+
+            // Keep the block uncompressed when encoding does not make it smaller
+            blockStream.clear();
+            SawyerStreamWriter blockWriter(blockStream);
+            blockWriter.writeChunk(SawyerEncoding::runLengthSingle, state.data() + offset, length);
+            if (blockStream.getLength() < length + kChunkHeaderSize)
+            {
+                writer.write(blockStream.data(), blockStream.getLength());
+            }
+            else
+            {
+                writer.writeChunk(SawyerEncoding::uncompressed, state.data() + offset, length);
+            }
+        }
+
+        const auto* data = reinterpret_cast<const uint8_t*>(ms.data());
+        return std::vector<uint8_t>(data, data + ms.getLength());
+    }
+
+    std::vector<uint8_t> decode(std::span<const uint8_t> payload, std::span<const uint8_t> baseline, size_t stateSize)
+    {
+        std::vector<uint8_t> state(stateSize);
+        std::copy_n(baseline.begin(), std::min(baseline.size(), stateSize), state.begin());
+
+        BinaryStream bs(payload.data(), payload.size());
+        SawyerStreamReader reader(bs);
+        while (bs.getPosition() < bs.getLength())
+        {
+            uint32_t blockIndex;
+            reader.read(&blockIndex, sizeof(blockIndex));
+
+            const auto offset = static_cast<size_t>(blockIndex) * kBlockSize;
+            const auto block = reader.readChunk();
+            if (offset >= stateSize || block.size() != std::min(kBlockSize, stateSize - offset))
+            {
+                throw Exception::RuntimeError("Invalid state block");
+            }
+            std::memcpy(state.data() + offset, block.data(), block.size());
+        }
+        return state;
+    }
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace OpenLoco::Network::StateTransfer
+{
+    // Game state is compared in blocks of this size, only blocks that differ from the baseline are sent
+    constexpr size_t kBlockSize = 0x2000;
+
+    // Encodes every block of state that differs from baseline, an empty baseline encodes all blocks.
+    // Each block is compressed with the Sawyer run length encoding.
+    std::vector<uint8_t> encode(std::span<const uint8_t> state, std::span<const uint8_t> baseline);
+
+    // Rebuilds a state of stateSize bytes from baseline and the blocks in an encoded payload.
+    // Throws if the payload is malformed.
+    std::vector<uint8_t> decode(std::span<const uint8_t> payload, std::span<const uint8_t> baseline, size_t stateSize);
+}
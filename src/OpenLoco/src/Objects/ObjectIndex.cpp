@@ -30,13 +30,21 @@
 #include "World/IndustryManager.h"
 #include "World/Station.h"
 #include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/JobPool.hpp>
 #include <OpenLoco/Core/Numerics.hpp>
 #include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <fstream>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -55,7 +63,8 @@ namespace OpenLoco::ObjectManager
     static loco_global<ObjectSelectionMeta, 0x0112C1C5> _objectSelectionMeta;
     static loco_global<std::array<uint16_t, kMaxObjectTypes>, 0x0112C181> _numObjectsPerType;
 
-    static constexpr uint8_t kCurrentIndexVersion = 3;
+    static constexpr uint8_t kCurrentIndexVersion = 4;
+    static constexpr size_t kScanBatchSizePerThread = 8;
 
 #pragma pack(push, 1)
     struct ObjectFolderState
@@ -78,8 +87,84 @@ namespace OpenLoco::ObjectManager
     static_assert(sizeof(IndexHeader) == 0x14);
 #pragma pack(pop)
 
+    // Objects are looked up by type and name. Several installed objects can share both (custom objects
+    // with different checksums) so each key lists every candidate in index order.
+    struct ObjectLookupKey
+    {
+        ObjectType type;
+        std::array<char, 8> name;
+
+        bool operator==(const ObjectLookupKey& rhs) const = default;
+    };
+
+    struct ObjectLookupKeyHash
+    {
+        size_t operator()(const ObjectLookupKey& key) const
+        {
+            uint64_t name = 0;
+            std::memcpy(&name, key.name.data(), sizeof(name));
+            return std::hash<uint64_t>{}(name) ^ (static_cast<size_t>(enumValue(key.type)) * 0x9E3779B9U);
+        }
+    };
+
+    // Byte offset of each entry within _installedObjectList
+    static std::vector<uint32_t> _installedObjectOffsets;
+    static std::unordered_map<ObjectLookupKey, std::vector<ObjectIndexId>, ObjectLookupKeyHash> _installedObjectLookup;
+
+    static ObjectLookupKey getLookupKey(const ObjectHeader& header)
+    {
+        ObjectLookupKey key{ header.getType(), {} };
+        std::memcpy(key.name.data(), header.name, sizeof(header.name));
+        return key;
+    }
+
+    static ObjectIndexEntry getEntry(ObjectIndexId id)
+    {
+        auto* ptr = *_installedObjectList + _installedObjectOffsets[id];
+        return ObjectIndexEntry::read(&ptr);
+    }
+
+    static void clearLookup()
+    {
+        _installedObjectOffsets.clear();
+        _installedObjectLookup.clear();
+    }
+
+    // Entry must already be written to _installedObjectList at offset
+    static void addEntryToLookup(ObjectIndexId id, size_t offset)
+    {
+        const auto& header = *reinterpret_cast<const ObjectHeader*>(*_installedObjectList + offset);
+        _installedObjectOffsets.push_back(static_cast<uint32_t>(offset));
+        _installedObjectLookup[getLookupKey(header)].push_back(id);
+    }
+
+    static void rebuildLookup()
+    {
+        clearLookup();
+        _installedObjectOffsets.reserve(_installedObjectCount);
+        _installedObjectLookup.reserve(_installedObjectCount);
+
+        auto* ptr = *_installedObjectList;
+        for (ObjectIndexId i = 0; i < _installedObjectCount; i++)
+        {
+            const auto offset = static_cast<size_t>(ptr - *_installedObjectList);
+            ObjectIndexEntry::read(&ptr);
+            addEntryToLookup(i, offset);
+        }
+    }
+
+    // Identifies the version of an object file that the index was built from
+    struct ObjectFileFingerprint
+    {
+        std::string filename;
+        uint64_t fileSize;
+        int64_t lastWriteTime;
+
+        bool operator==(const ObjectFileFingerprint& rhs) const = default;
+    };
+
     // 0x00470F3C
-    static ObjectFolderState getCurrentObjectFolderState()
+    static ObjectFolderState getCurrentObjectFolderState(std::vector<ObjectFileFingerprint>& files)
     {
         ObjectFolderState currentState;
         const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
@@ -96,9 +181,12 @@ namespace OpenLoco::ObjectManager
             }
             currentState.numObjects++;
             const auto lastWrite = file.last_write_time().time_since_epoch().count();
+            const auto fileSize = file.file_size();
             currentState.dateHash ^= ((lastWrite >> 32) ^ (lastWrite & 0xFFFFFFFF));
             currentState.dateHash = std::rotr(currentState.dateHash, 5);
-            currentState.totalFileSize += file.file_size();
+            currentState.totalFileSize += fileSize;
+
+            files.push_back(ObjectFileFingerprint{ file.path().filename().u8string(), fileSize, static_cast<int64_t>(lastWrite) });
         }
 
         // NB: vanilla used to set just flag 24 to 1; we use it as a version byte.
@@ -120,7 +208,9 @@ namespace OpenLoco::ObjectManager
         return false;
     }
 
-    static void saveIndex(const IndexHeader& header)
+    // The packed entries are followed by the fingerprint of every object file that was scanned
+    // (including ones that failed to load) so that the index can be refreshed incrementally.
+    static void saveIndex(const IndexHeader& header, const std::vector<ObjectFileFingerprint>& files)
     {
         Core::Timer saveTimer;
 
@@ -135,49 +225,16 @@ namespace OpenLoco::ObjectManager
         stream.writeValue(header);
         stream.write(*_installedObjectList, header.fileSize);
 
-        Logging::verbose("Saved object index in {} milliseconds.", saveTimer.elapsed());
-    }
-
-    static std::pair<ObjectIndexEntry, size_t> createPartialNewEntry(std::byte* entryBuffer, const ObjectHeader& objHeader, const fs::path filename)
-    {
-        ObjectIndexEntry entry{};
-        size_t newEntrySize = 0;
-
-        // Header
-        std::memcpy(&entryBuffer[newEntrySize], &objHeader, sizeof(objHeader));
-        entry._header = reinterpret_cast<ObjectHeader*>(&entryBuffer[newEntrySize]);
-        newEntrySize += sizeof(objHeader);
-
-        // Filename
-        std::strcpy(reinterpret_cast<char*>(&entryBuffer[newEntrySize]), filename.u8string().c_str());
-        entry._filename = reinterpret_cast<char*>(&entryBuffer[newEntrySize]);
-        newEntrySize += strlen(reinterpret_cast<char*>(&entryBuffer[newEntrySize])) + 1;
-
-        // Header2 NULL
-        ObjectHeader2 objHeader2;
-        objHeader2.decodedFileSize = std::numeric_limits<uint32_t>::max();
-        std::memcpy(&entryBuffer[newEntrySize], &objHeader2, sizeof(objHeader2));
-        newEntrySize += sizeof(objHeader2);
-
-        // Name NULL
-        entryBuffer[newEntrySize] = std::byte(0);
-        entry._name = reinterpret_cast<char*>(&entryBuffer[newEntrySize]);
-        newEntrySize += strlen(reinterpret_cast<char*>(&entryBuffer[newEntrySize])) + 1;
-
-        // Header3 NULL
-        ObjectHeader3 objHeader3{};
-        std::memcpy(&entryBuffer[newEntrySize], &objHeader3, sizeof(objHeader3));
-        newEntrySize += sizeof(objHeader3);
-
-        // ObjectList1
-        const uint8_t size1 = 0;
-        entryBuffer[newEntrySize++] = std::byte(size1);
-
-        // ObjectList2
-        const uint8_t size2 = 0;
-        entryBuffer[newEntrySize++] = std::byte(size2);
+        stream.writeValue(static_cast<uint32_t>(files.size()));
+        for (const auto& file : files)
+        {
+            stream.writeValue(file.fileSize);
+            stream.writeValue(file.lastWriteTime);
+            stream.writeValue(static_cast<uint16_t>(file.filename.size()));
+            stream.write(file.filename.data(), file.filename.size());
+        }
 
-        return std::make_pair(entry, newEntrySize);
+        Logging::verbose("Saved object index in {} milliseconds.", saveTimer.elapsed());
     }
 
     // TODO: Take dependent object vectors from loadTemporary
@@ -228,78 +285,114 @@ namespace OpenLoco::ObjectManager
         return std::make_pair(entry, newEntrySize);
     }
 
-    // Adds a new object to the index by: 1. creating a partial index, 2. validating, 3. creating a full index entry
-    static void addObjectToIndex(const fs::path filepath, size_t& usedBufferSize)
+    // Object file read and decoded by a worker thread ready to be added to the index
+    struct ScannedObject
+    {
+        fs::path path;
+        std::optional<PreLoadedObject> preLoadObj;
+        std::string error;
+    };
+
+    // Thread safe: does not log or touch any of the index or object globals
+    static void scanObjectFile(ScannedObject& scanned)
     {
-        ObjectHeader objHeader{};
         try
         {
-            FileStream stream;
-            stream.open(filepath, StreamMode::read);
-            if (!stream.isOpen())
+            ObjectHeader objHeader{};
+            {
+                FileStream stream;
+                stream.open(scanned.path, StreamMode::read);
+                if (!stream.isOpen())
+                {
+                    scanned.error = "Unable to open object file.";
+                    return;
+                }
+                objHeader = stream.readValue<ObjectHeader>();
+            }
+
+            std::string_view error;
+            scanned.preLoadObj = preLoadObjectFile(scanned.path, objHeader, error);
+            if (!scanned.preLoadObj.has_value())
             {
-                Logging::error("Unable to open object index file.");
-                return;
+                scanned.error = error;
             }
-            objHeader = stream.readValue<ObjectHeader>();
         }
         catch (const std::runtime_error& ex)
         {
-            Logging::error("Unable to read object index header: {}", ex.what());
-            return;
+            scanned.error = ex.what();
         }
+    }
 
-        const auto curObjPos = usedBufferSize;
-        const auto partialNewEntry = createPartialNewEntry(&_installedObjectList[usedBufferSize], objHeader, filepath.filename());
-        usedBufferSize += partialNewEntry.second;
-        _installedObjectCount++;
+    // Adds a scanned object to the index by: 1. loading it as the temporary object, 2. creating a full index entry
+    static void addObjectToIndex(ScannedObject& scanned, size_t& usedBufferSize)
+    {
+        if (!scanned.preLoadObj.has_value())
+        {
+            Logging::error("Unable to load the object file '{}', can't add to index: {}", scanned.path.filename().u8string(), scanned.error);
+            return;
+        }
+        const auto objHeader = scanned.preLoadObj->header;
 
         _isPartialLoaded = true;
         _dependentObjectsVector = _dependentObjectVectorData;
-        const auto loadResult = loadTemporaryObject(objHeader);
+        const auto metaData = loadTemporaryObject(*scanned.preLoadObj);
         _dependentObjectsVector = reinterpret_cast<std::byte*>(-1);
         _isPartialLoaded = false;
-        _installedObjectCount--;
-        // Rewind as it is only a partial object loaded
-        usedBufferSize = curObjPos;
-
-        if (!loadResult.has_value())
-        {
-            Logging::error("Unable to load the object '{}', can't add to index", objHeader.getName());
-            return;
-        }
+        scanned.preLoadObj.reset();
 
         // Load full entry into temp buffer.
         // 0x009D1CC8
         std::byte newEntryBuffer[0x2000] = {};
-        const auto [newEntry, newEntrySize] = createNewEntry(newEntryBuffer, objHeader, filepath.filename(), loadResult.value());
+        const auto [newEntry, newEntrySize] = createNewEntry(newEntryBuffer, objHeader, scanned.path.filename(), metaData);
 
         freeTemporaryObject();
 
-        auto* indexPtr = *_installedObjectList;
-        // This ptr will be pointing at where in the object list to install the new entry
-        auto* installPtr = indexPtr;
-        for (uint32_t i = 0; i < _installedObjectCount; i++)
+        // Vanilla inserted each entry at its sorted position. We append and sort once at the end (see sortIndexByName).
+        std::memcpy(&_installedObjectList[usedBufferSize], newEntryBuffer, newEntrySize);
+        addEntryToLookup(_installedObjectCount, usedBufferSize);
+        usedBufferSize += newEntrySize;
+
+        _installedObjectCount++;
+    }
+
+    // Orders the index by object name. Stable so that objects sharing a name keep their scan order,
+    // matching the vanilla insertion behaviour.
+    static bool sortIndexByName(size_t usedBufferSize)
+    {
+        if (_installedObjectCount == 0)
         {
-            auto entry = ObjectIndexEntry::read(&indexPtr);
-            if (strcmp(newEntry._name, entry._name) < 0)
-            {
-                break;
-            }
-            // If cmp < 0 then we will want to install at the previous indexPtr location
-            installPtr = indexPtr;
+            return true;
         }
 
-        auto moveSize = usedBufferSize - (installPtr - *_installedObjectList);
-        std::memmove(installPtr + newEntrySize, installPtr, moveSize);
-        std::memcpy(installPtr, newEntryBuffer, newEntrySize);
-        usedBufferSize += newEntrySize;
+        std::vector<ObjectIndexId> order(_installedObjectCount);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [](const ObjectIndexId lhs, const ObjectIndexId rhs) {
+            return strcmp(getEntry(lhs)._name, getEntry(rhs)._name) < 0;
+        });
 
-        _installedObjectCount++;
+        auto* sortedList = static_cast<std::byte*>(malloc(usedBufferSize));
+        if (sortedList == nullptr)
+        {
+            return false;
+        }
+
+        size_t sortedSize = 0;
+        for (const auto id : order)
+        {
+            const auto offset = _installedObjectOffsets[id];
+            const auto end = id + 1 < _installedObjectCount ? _installedObjectOffsets[id + 1] : usedBufferSize;
+            std::memcpy(&sortedList[sortedSize], &_installedObjectList[offset], end - offset);
+            sortedSize += end - offset;
+        }
+
+        free(*_installedObjectList);
+        _installedObjectList = sortedList;
+        rebuildLookup();
+        return true;
     }
 
-    // 0x0047118B
-    static void createIndex(const ObjectFolderState& currentState)
+    // Creates the index from the entries kept from a previous index plus the scanned objectFiles
+    static void buildIndex(const ObjectFolderState& currentState, const std::vector<ObjectFileFingerprint>& files, const std::vector<fs::path>& objectFiles, std::span<const std::byte> keptEntries, uint32_t numKeptEntries)
     {
         Ui::processMessagesMini();
         const auto progressString = _isFirstTime ? StringIds::starting_for_the_first_time : StringIds::checking_object_files;
@@ -307,6 +400,7 @@ namespace OpenLoco::ObjectManager
 
         // Reset
         reloadAll();
+        clearLookup();
         if (reinterpret_cast<int32_t>(*_installedObjectList) != -1)
         {
             free(*_installedObjectList);
@@ -314,6 +408,10 @@ namespace OpenLoco::ObjectManager
 
         // Prepare initial object list buffer (we will grow this as required)
         size_t bufferSize = 0x4000;
+        while (bufferSize < keptEntries.size() + 0x231E)
+        {
+            bufferSize *= 2;
+        }
         _installedObjectList = static_cast<std::byte*>(malloc(bufferSize));
         if (_installedObjectList == nullptr)
         {
@@ -322,49 +420,78 @@ namespace OpenLoco::ObjectManager
             return;
         }
 
-        _installedObjectCount = 0;
-        // Create new index by iterating all DAT files and processing
+        std::copy(keptEntries.begin(), keptEntries.end(), *_installedObjectList);
+        _installedObjectCount = numKeptEntries;
+        rebuildLookup();
+
+        // Add to the index by processing each DAT file
         IndexHeader header{};
-        uint8_t progress = 0;      // Progress is used for the ProgressBar Ui element
-        size_t usedBufferSize = 0; // Keep track of used space to allow for growth and for final sizing
-        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
-        for (const auto& file : fs::directory_iterator(objectPath, fs::directory_options::skip_permission_denied))
-        {
-            if (!file.is_regular_file())
+        uint32_t numScanned = 0;                    // Number of objectFiles processed so far
+        uint8_t progress = 0;                       // Progress is used for the ProgressBar Ui element
+        size_t usedBufferSize = keptEntries.size(); // Keep track of used space to allow for growth and for final sizing
+
+        // Files are read, decoded and checksummed on the pool one batch at a time. While the next batch is
+        // being decoded the previous one is added to the index on this thread as loading uses legacy globals.
+        // NB: batches must outlive the pool as queued tasks reference them.
+        std::array<std::vector<ScannedObject>, 2> batches;
+        Core::JobPool pool;
+        const auto batchSize = pool.getNumThreads() * kScanBatchSizePerThread;
+
+        const auto queueBatch = [&](std::vector<ScannedObject>& batch, size_t batchStart) {
+            batchStart = std::min(batchStart, objectFiles.size());
+            const auto batchEnd = std::min(batchStart + batchSize, objectFiles.size());
+            batch.clear();
+            batch.resize(batchEnd - batchStart);
+            for (size_t i = 0; i < batch.size(); i++)
             {
-                continue;
-            }
-            const auto extension = file.path().extension().u8string();
-            if (!Utility::iequals(extension, ".DAT"))
-            {
-                continue;
+                batch[i].path = objectFiles[batchStart + i];
+                pool.addTask([&scanned = batch[i]] { scanObjectFile(scanned); });
             }
-            Ui::processMessagesMini();
-            header.state.numObjects++;
+        };
 
-            // Cheap calculation of (curObjectCount / totalObjectCount) * 256
-            const auto newProgress = (header.state.numObjects << 8) / ((currentState.numObjects & 0xFFFFFF) + 1);
-            if (progress != newProgress)
-            {
-                progress = newProgress;
-                Ui::ProgressBar::setProgress(newProgress);
-            }
+        queueBatch(batches[0], 0);
+        pool.join();
+        for (size_t batchStart = 0, batchIndex = 0; batchStart < objectFiles.size(); batchStart += batchSize, batchIndex ^= 1)
+        {
+            queueBatch(batches[batchIndex ^ 1], batchStart + batchSize);
 
-            // Grow object list buffer if near limit
-            const auto remainingBuffer = bufferSize - usedBufferSize;
-            if (remainingBuffer < 0x231E)
+            for (auto& scanned : batches[batchIndex])
             {
-                // Original grew buffer at slower rate. Memory is cheap though
-                bufferSize *= 2;
-                _installedObjectList = static_cast<std::byte*>(realloc(*_installedObjectList, bufferSize));
-                if (_installedObjectList == nullptr)
+                Ui::processMessagesMini();
+                numScanned++;
+
+                // Cheap calculation of (curObjectCount / totalObjectCount) * 256
+                const auto newProgress = (numScanned << 8) / (objectFiles.size() + 1);
+                if (progress != newProgress)
                 {
-                    exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
-                    return;
+                    progress = newProgress;
+                    Ui::ProgressBar::setProgress(newProgress);
+                }
+
+                // Grow object list buffer if near limit
+                const auto remainingBuffer = bufferSize - usedBufferSize;
+                if (remainingBuffer < 0x231E)
+                {
+                    // Original grew buffer at slower rate. Memory is cheap though
+                    bufferSize *= 2;
+                    _installedObjectList = static_cast<std::byte*>(realloc(*_installedObjectList, bufferSize));
+                    if (_installedObjectList == nullptr)
+                    {
+                        exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+                        return;
+                    }
                 }
+
+                addObjectToIndex(scanned, usedBufferSize);
             }
 
-            addObjectToIndex(file.path(), usedBufferSize);
+            pool.join();
+        }
+
+        if (!sortIndexByName(usedBufferSize))
+        {
+            exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+            return;
         }
 
         // New index creation completed. Reset and save result.
@@ -372,12 +499,78 @@ namespace OpenLoco::ObjectManager
         header.fileSize = usedBufferSize;
         header.numObjects = _installedObjectCount;
         header.state = currentState;
-        saveIndex(header);
+        saveIndex(header, files);
 
         Ui::ProgressBar::end();
     }
 
-    static bool tryLoadIndex(const ObjectFolderState& currentState)
+    // 0x0047118B
+    static void createIndex(const ObjectFolderState& currentState, const std::vector<ObjectFileFingerprint>& files)
+    {
+        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
+        std::vector<fs::path> objectFiles;
+        objectFiles.reserve(files.size());
+        for (const auto& file : files)
+        {
+            objectFiles.push_back(objectPath / fs::u8path(file.filename));
+        }
+
+        buildIndex(currentState, files, objectFiles, {}, 0);
+    }
+
+    // Keeps the entries of object files that are unchanged since the loaded index was saved and only
+    // scans the files that have been added or modified. Entries of removed files are dropped.
+    static void refreshIndex(const ObjectFolderState& currentState, const std::vector<ObjectFileFingerprint>& files, const std::vector<ObjectFileFingerprint>& indexedFiles)
+    {
+        std::unordered_map<std::string_view, const ObjectFileFingerprint*> indexedFileMap;
+        for (const auto& file : indexedFiles)
+        {
+            indexedFileMap.emplace(file.filename, &file);
+        }
+
+        const auto objectPath = Environment::getPathNoWarning(Environment::PathId::objects);
+        std::unordered_set<std::string_view> unchangedFiles;
+        std::vector<fs::path> objectFiles;
+        for (const auto& file : files)
+        {
+            const auto it = indexedFileMap.find(file.filename);
+            if (it != indexedFileMap.end() && *it->second == file)
+            {
+                unchangedFiles.insert(file.filename);
+            }
+            else
+            {
+                objectFiles.push_back(objectPath / fs::u8path(file.filename));
+            }
+        }
+
+        std::vector<std::byte> keptEntries;
+        uint32_t numKeptEntries = 0;
+        auto* ptr = *_installedObjectList;
+        for (uint32_t i = 0; i < _installedObjectCount; i++)
+        {
+            auto* entryStart = ptr;
+            const auto entry = ObjectIndexEntry::read(&ptr);
+            if (unchangedFiles.contains(entry._filename))
+            {
+                keptEntries.insert(keptEntries.end(), entryStart, ptr);
+                numKeptEntries++;
+            }
+        }
+
+        Logging::info("Refreshing object index: {} entries kept, {} files to scan.", numKeptEntries, objectFiles.size());
+
+        buildIndex(currentState, files, objectFiles, keptEntries, numKeptEntries);
+    }
+
+    enum class IndexLoadResult : uint8_t
+    {
+        upToDate,
+        outOfDate, // Loaded but needs refreshing for changed object files
+        unusable,
+    };
+
+    static IndexLoadResult tryLoadIndex(const ObjectFolderState& currentState, std::vector<ObjectFileFingerprint>& indexedFiles)
     {
         Core::Timer loadTimer;
 
@@ -385,63 +578,91 @@ namespace OpenLoco::ObjectManager
         if (!fs::exists(indexPath))
         {
             Logging::verbose("Object index does not exist.");
-            return false;
+            return IndexLoadResult::unusable;
         }
         FileStream stream;
         stream.open(indexPath, StreamMode::read);
         if (!stream.isOpen())
         {
             Logging::error("Unable to load the object index.");
-            return false;
+            return IndexLoadResult::unusable;
         }
 
         try
         {
             // 0x00112A14C -> 160
             auto header = stream.readValue<IndexHeader>();
-            if (header.state != currentState)
+            if ((header.state.numObjects >> 24) != kCurrentIndexVersion)
             {
-                Logging::info("Object index out of date.");
-                return false;
+                Logging::info("Object index version out of date.");
+                return IndexLoadResult::unusable;
             }
-            else
+
+            clearLookup();
+            if (reinterpret_cast<int32_t>(*_installedObjectList) != -1)
             {
-                if (reinterpret_cast<int32_t>(*_installedObjectList) != -1)
-                {
-                    free(*_installedObjectList);
-                }
-                _installedObjectList = static_cast<std::byte*>(malloc(header.fileSize));
-                if (_installedObjectList == nullptr)
+                free(*_installedObjectList);
+            }
+            _installedObjectList = static_cast<std::byte*>(malloc(header.fileSize));
+            if (_installedObjectList == nullptr)
+            {
+                exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
+                return IndexLoadResult::unusable;
+            }
+            stream.read(*_installedObjectList, header.fileSize);
+            _installedObjectCount = header.numObjects;
+
+            if (header.state != currentState)
+            {
+                Logging::info("Object index out of date.");
+
+                const auto numFiles = stream.readValue<uint32_t>();
+                indexedFiles.reserve(numFiles);
+                for (uint32_t i = 0; i < numFiles; i++)
                 {
-                    exitWithError(StringIds::unable_to_allocate_enough_memory, StringIds::game_init_failure);
-                    return false;
+                    ObjectFileFingerprint file{};
+                    file.fileSize = stream.readValue<uint64_t>();
+                    file.lastWriteTime = stream.readValue<int64_t>();
+                    file.filename.resize(stream.readValue<uint16_t>());
+                    stream.read(file.filename.data(), file.filename.size());
+                    indexedFiles.push_back(std::move(file));
                 }
-                stream.read(*_installedObjectList, header.fileSize);
-                _installedObjectCount = header.numObjects;
-
-                Logging::verbose("Loaded object index in {} milliseconds.", loadTimer.elapsed());
+                return IndexLoadResult::outOfDate;
             }
+
+            rebuildLookup();
+
+            Logging::verbose("Loaded object index in {} milliseconds.", loadTimer.elapsed());
         }
         catch (const std::runtime_error& ex)
         {
             Logging::error("Unable to load the object index: {}", ex.what());
-            return false;
+            return IndexLoadResult::unusable;
         }
 
         reloadAll();
 
-        return true;
+        return IndexLoadResult::upToDate;
     }
 
     // 0x00470F3C
     void loadIndex()
     {
         // 0x00112A138 -> 144
-        const auto currentState = getCurrentObjectFolderState();
+        std::vector<ObjectFileFingerprint> files;
+        const auto currentState = getCurrentObjectFolderState(files);
 
-        if (!tryLoadIndex(currentState))
+        std::vector<ObjectFileFingerprint> indexedFiles;
+        switch (tryLoadIndex(currentState, indexedFiles))
         {
-            createIndex(currentState);
+            case IndexLoadResult::upToDate:
+                break;
+            case IndexLoadResult::outOfDate:
+                refreshIndex(currentState, files, indexedFiles);
+                break;
+            case IndexLoadResult::unusable:
+                createIndex(currentState, files);
+                break;
         }
 
         _customObjectsInIndex = hasCustomObjectsInIndex();
@@ -469,13 +690,20 @@ namespace OpenLoco::ObjectManager
 
     static std::optional<std::pair<ObjectIndexId, ObjectIndexEntry>> internalFindObjectInIndex(const ObjectHeader& objectHeader)
     {
-        const auto objects = getAvailableObjects(objectHeader.getType());
-        auto res = std::find_if(std::begin(objects), std::end(objects), [&objectHeader](auto& obj) { return *obj.second._header == objectHeader; });
-        if (res == std::end(objects))
+        const auto it = _installedObjectLookup.find(getLookupKey(objectHeader));
+        if (it == _installedObjectLookup.end())
         {
             return std::nullopt;
         }
-        return *res;
+        for (const auto id : it->second)
+        {
+            const auto entry = getEntry(id);
+            if (*entry._header == objectHeader)
+            {
+                return std::make_pair(id, entry);
+            }
+        }
+        return std::nullopt;
     }
 
     std::optional<ObjectIndexEntry> findObjectInIndex(const ObjectHeader& objectHeader)
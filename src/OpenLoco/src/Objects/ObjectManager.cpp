@@ -379,23 +379,8 @@ namespace OpenLoco::ObjectManager
         }
     }
 
-    struct PreLoadedObject
+    std::optional<PreLoadedObject> preLoadObjectFile(const fs::path& filePath, const ObjectHeader& header, std::string_view& error)
     {
-        std::span<std::byte> objectData;
-        Object* object; // Owning pointer!
-        ObjectHeader header;
-    };
-
-    static std::optional<PreLoadedObject> findAndPreLoadObject(const ObjectHeader& header)
-    {
-        auto installedObject = findObjectInIndex(header);
-        if (!installedObject.has_value())
-        {
-            return std::nullopt;
-        }
-
-        const auto filePath = Environment::getPath(Environment::PathId::objects) / fs::u8path(installedObject->_filename);
-
         FileStream fs(filePath, StreamMode::read);
         SawyerStreamReader stream(fs);
         PreLoadedObject preLoadObj{};
@@ -404,7 +389,7 @@ namespace OpenLoco::ObjectManager
         {
             // Something wrong has happened and installed object does not match index
             // Vanilla continued to search for subsequent matching installed headers.
-            Logging::error("Mismatch between installed object header and object file header!");
+            error = "Mismatch between installed object header and object file header!";
             return std::nullopt;
         }
 
@@ -414,7 +399,7 @@ namespace OpenLoco::ObjectManager
         if (!computeObjectChecksum(preLoadObj.header, data))
         {
             // Something wrong has happened and installed object checksum is broken
-            Logging::error("Mismatch between installed object header checksum and object file checksum!");
+            error = "Mismatch between installed object header checksum and object file checksum!";
             return std::nullopt;
         }
 
@@ -422,6 +407,7 @@ namespace OpenLoco::ObjectManager
         preLoadObj.object = reinterpret_cast<Object*>(malloc(data.size()));
         if (preLoadObj.object == nullptr)
         {
+            error = "Unable to allocate memory for object.";
             return std::nullopt;
         }
         std::copy(std::begin(data), std::end(data), reinterpret_cast<std::byte*>(preLoadObj.object));
@@ -432,11 +418,32 @@ namespace OpenLoco::ObjectManager
         {
             free(preLoadObj.object);
             // Object failed validation
-            Logging::error("Object {} in index failed validation! (This should not be possible)", header.getName());
+            error = "Object in index failed validation! (This should not be possible)";
             return std::nullopt;
         }
 
-        _decodedSize = preLoadObj.objectData.size();
+        return preLoadObj;
+    }
+
+    static std::optional<PreLoadedObject> findAndPreLoadObject(const ObjectHeader& header)
+    {
+        auto installedObject = findObjectInIndex(header);
+        if (!installedObject.has_value())
+        {
+            return std::nullopt;
+        }
+
+        const auto filePath = Environment::getPath(Environment::PathId::objects) / fs::u8path(installedObject->_filename);
+
+        std::string_view error;
+        auto preLoadObj = preLoadObjectFile(filePath, header, error);
+        if (!preLoadObj.has_value())
+        {
+            Logging::error("{} ({})", error, header.getName());
+            return std::nullopt;
+        }
+
+        _decodedSize = preLoadObj->objectData.size();
 
         return preLoadObj;
     }
@@ -450,17 +457,23 @@ namespace OpenLoco::ObjectManager
         {
             return std::nullopt;
         }
+        return loadTemporaryObject(*preLoadObj);
+    }
+
+    TempLoadMetaData loadTemporaryObject(PreLoadedObject& preLoadObj)
+    {
+        _decodedSize = preLoadObj.objectData.size();
 
         const uint32_t oldNumImages = getTotalNumImages();
         setTotalNumImages(Gfx::G1ExpectedCount::kDisc);
 
-        _temporaryObject = preLoadObj->object;
+        _temporaryObject = preLoadObj.object;
         _isPartialLoaded = true;
         _isTemporaryObject = 0xFF;
 
         auto* depObjs = Interop::addr<0x0050D158, uint8_t*>();
         DependentObjects dependencies;
-        callObjectLoad({ preLoadObj->header.getType(), 0 }, *preLoadObj->object, preLoadObj->objectData, depObjs != reinterpret_cast<uint8_t*>(0xFFFFFFFF) ? &dependencies : nullptr);
+        callObjectLoad({ preLoadObj.header.getType(), 0 }, *preLoadObj.object, preLoadObj.objectData, depObjs != reinterpret_cast<uint8_t*>(0xFFFFFFFF) ? &dependencies : nullptr);
 
         if (depObjs != reinterpret_cast<uint8_t*>(0xFFFFFFFF))
         {
@@ -484,19 +497,19 @@ namespace OpenLoco::ObjectManager
         setTotalNumImages(oldNumImages);
 
         TempLoadMetaData result{};
-        result.fileSizeHeader.decodedFileSize = preLoadObj->objectData.size();
+        result.fileSizeHeader.decodedFileSize = preLoadObj.objectData.size();
         result.displayData.numImages = _numImages;
 
-        if (header.getType() == ObjectType::competitor)
+        if (preLoadObj.header.getType() == ObjectType::competitor)
         {
-            auto* competitor = reinterpret_cast<CompetitorObject*>(preLoadObj->object);
+            auto* competitor = reinterpret_cast<CompetitorObject*>(preLoadObj.object);
             result.displayData.aggressiveness = competitor->aggressiveness;
             result.displayData.competitiveness = competitor->competitiveness;
             result.displayData.intelligence = competitor->intelligence;
         }
-        else if (header.getType() == ObjectType::vehicle)
+        else if (preLoadObj.header.getType() == ObjectType::vehicle)
         {
-            auto* vehicle = reinterpret_cast<VehicleObject*>(preLoadObj->object);
+            auto* vehicle = reinterpret_cast<VehicleObject*>(preLoadObj.object);
             result.displayData.vehicleSubType = enumValue(vehicle->type);
         }
 
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Object.h"
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <optional>
 #include <span>
+#include <string_view>
 #include <vector>
 
 namespace OpenLoco
@@ -159,8 +161,21 @@ namespace OpenLoco::ObjectManager
         ObjectHeader3 displayData;
     };
 
+    struct PreLoadedObject
+    {
+        std::span<std::byte> objectData;
+        Object* object; // Owning pointer!
+        ObjectHeader header;
+    };
+
+    // Reads, decodes and validates an object file. Touches no global state so may be called from a
+    // worker thread. On failure error is set to the reason. Throws if the file can not be read.
+    std::optional<PreLoadedObject> preLoadObjectFile(const fs::path& filePath, const ObjectHeader& header, std::string_view& error);
+
     void freeTemporaryObject();
     std::optional<TempLoadMetaData> loadTemporaryObject(const ObjectHeader& header);
+    // Takes ownership of the pre-loaded object which becomes the temporary object
+    TempLoadMetaData loadTemporaryObject(PreLoadedObject& preLoadObj);
     Object* getTemporaryObject();
     bool isTemporaryObjectLoad();
 
@@ -24,6 +24,7 @@
 #endif
 
 #include "Audio/Audio.h"
+#include "Benchmark.h"
 #include "Config.h"
 #include "Date.h"
 #include "Drawing/SoftwareDrawingEngine.h"
@@ -614,6 +615,7 @@ namespace OpenLoco
                 Audio::updateSounds();
 
                 Network::update();
+                S5::pollPendingExport();
 
                 addr<0x0050C1AE, int32_t>()++;
                 if (Intro::isActive())
@@ -772,26 +774,59 @@ namespace OpenLoco
 
         ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
         ScenarioManager::setScenarioTicks2(ScenarioManager::getScenarioTicks2() + 1);
+        // Vanilla code run in between ticks may have changed tile elements in place and the catchment map
+        World::TileManager::invalidateIndex();
+        invalidateCatchmentBounds();
         Network::processGameCommands(ScenarioManager::getScenarioTicks());
 
+        Benchmark::beginTick();
         recordTickStartPrng();
         call(0x004613F0); // Map::TileManager::reorg?
+        World::TileManager::invalidateIndex();
         addr<0x00F25374, uint8_t>() = S5::getOptions().madeAnyChanges;
         dateTick();
-        World::TileManager::update();
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::tileManager);
+            World::TileManager::compactElements();
+            World::TileManager::update();
+        }
         World::WaveManager::update();
-        TownManager::update();
-        IndustryManager::update();
-        VehicleManager::update();
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::townManager);
+            TownManager::update();
+        }
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::industryManager);
+            IndustryManager::update();
+        }
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::vehicleManager);
+            VehicleManager::update();
+        }
         sub_46FFCA();
-        StationManager::update();
-        EffectsManager::update();
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::stationManager);
+            StationManager::update();
+        }
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::effectsManager);
+            EffectsManager::update();
+        }
         sub_46FFCA();
-        CompanyManager::update();
-        World::AnimationManager::update();
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::companyManager);
+            CompanyManager::update();
+            // The ai still runs vanilla code that may write the catchment map
+            invalidateCatchmentBounds();
+        }
+        {
+            Benchmark::ScopedSubsystemTimer timer(Benchmark::Subsystem::animationManager);
+            World::AnimationManager::update();
+        }
         Audio::updateVehicleNoise();
         Audio::updateAmbientNoise();
         Title::update();
+        Network::processTickEnd(ScenarioManager::getScenarioTicks());
 
         S5::getOptions().madeAnyChanges = addr<0x00F25374, uint8_t>();
         if (_loadErrorCode != 0)
@@ -809,6 +844,7 @@ namespace OpenLoco
             }
             _loadErrorCode = 0;
         }
+        Benchmark::endTick();
     }
 
     static void autosaveReset()
@@ -889,7 +925,12 @@ namespace OpenLoco
 
             auto autosaveFullPath8 = autosaveFullPath.u8string();
             Logging::info("Autosaving game to {}", autosaveFullPath8.c_str());
-            S5::exportGameStateToFile(autosaveFullPath, S5::SaveFlags::noWindowClose);
+            S5::exportGameStateToFileAsync(autosaveFullPath, S5::SaveFlags::noWindowClose, [](bool success) {
+                if (success)
+                {
+                    autosaveClean();
+                }
+            });
         }
         catch (const std::exception& e)
         {
@@ -907,7 +948,6 @@ namespace OpenLoco
             if (freq > 0 && _monthsSinceLastAutosave >= freq)
             {
                 autosave();
-                autosaveClean();
             }
         }
     }
@@ -1030,7 +1070,9 @@ namespace OpenLoco
 
     static void fixedUpdate()
     {
+        // Entities may still be drawn where they were tweened to if the frame rate was uncapped
         auto& tweener = EntityTweener::get();
+        tweener.restore();
         tweener.reset();
 
         if (_accumulator < UpdateTime)
@@ -1116,27 +1158,33 @@ namespace OpenLoco
         _glpCmdLine = "";
     }
 
-    void simulateGame(const fs::path& path, int32_t ticks)
+    void initialiseSimulation()
     {
         Config::read();
         Environment::resolvePaths();
         resetCmdline();
         registerHooks();
+        initialise();
+    }
 
+    bool simulateLoadedGame(const fs::path& path, int32_t ticks)
+    {
+        bool loaded = true;
         try
         {
-            initialise();
             loadFile(path);
         }
         catch (const std::exception& e)
         {
             Logging::error("Unable to simulate park: {}", e.what());
+            loaded = false;
         }
         catch (const GameException i)
         {
             if (i != GameException::Interrupt)
             {
                 Logging::error("Unable to simulate park!");
+                loaded = false;
             }
             else
             {
@@ -1144,6 +1192,24 @@ namespace OpenLoco
             }
         }
         tickLogic(ticks);
+        return loaded;
+    }
+
+    void simulateGame(const fs::path& path, int32_t ticks)
+    {
+        try
+        {
+            initialiseSimulation();
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to simulate park: {}", e.what());
+        }
+        catch (const GameException)
+        {
+            Logging::error("Unable to simulate park!");
+        }
+        simulateLoadedGame(path, ticks);
     }
 
     // 0x00406D13
@@ -1185,6 +1251,7 @@ namespace OpenLoco
 
             resetCmdline();
             registerHooks();
+            World::TileManager::setIndexEnabled(cfg.tileElementIndex);
 
             Ui::createWindow(cfg.display);
             call(0x004078FE); // getSystemInfo used for some config, multiplayer name,
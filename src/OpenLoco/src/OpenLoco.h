@@ -24,6 +24,10 @@ namespace OpenLoco
     void initialiseViewports();
     void simulateGame(const fs::path& path, int32_t ticks);
 
+    // Loads the game data once so that any number of saves can then be simulated with simulateLoadedGame
+    void initialiseSimulation();
+    bool simulateLoadedGame(const fs::path& path, int32_t ticks);
+
     void sub_431695(uint16_t var_F253A0);
     int main(std::vector<std::string>&& argv);
     bool promptTickLoop(std::function<bool()> tickAction);
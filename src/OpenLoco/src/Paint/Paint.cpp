@@ -15,15 +15,59 @@
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui::ViewportInteraction;
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::Paint
 {
     PaintSession _session;
 
+    static PaintStatistics _frameStatistics{};
+    static PaintStatistics _lastFrameStatistics{};
+
+    std::span<PaintEntry> PaintEntryArena::reset()
+    {
+        _nextBlock = 0;
+        if (!_initialBlock.empty())
+        {
+            return _initialBlock;
+        }
+        return nextBlock();
+    }
+
+    std::span<PaintEntry> PaintEntryArena::nextBlock()
+    {
+        if (_nextBlock >= kMaxBlocks)
+        {
+            return {};
+        }
+        if (_nextBlock == _blocks.size())
+        {
+            // Entries are zeroed as they are allocated so there is no need to initialise the block
+            _blocks.push_back(std::make_unique<PaintEntry[]>(kBlockSize));
+        }
+        return std::span<PaintEntry>(_blocks[_nextBlock++].get(), kBlockSize);
+    }
+
+    void endFrame()
+    {
+        if (_frameStatistics.numOverflows != 0 || _frameStatistics.numDropped != 0)
+        {
+            Logging::verbose("Paint entries overflowed {} times and dropped {} structs, peak {} entries", _frameStatistics.numOverflows, _frameStatistics.numDropped, _frameStatistics.peakEntries);
+        }
+        _lastFrameStatistics = _frameStatistics;
+        _frameStatistics = {};
+    }
+
+    const PaintStatistics& getLastFrameStatistics()
+    {
+        return _lastFrameStatistics;
+    }
+
     void PaintSession::setEntityPosition(const World::Pos2& pos)
     {
         _spritePositionX = pos.x;
@@ -324,11 +368,51 @@ namespace OpenLoco::Paint
         return attached;
     }
 
+    PaintEntryArena& PaintSession::getDefaultArena()
+    {
+        static PaintEntryArena arena(std::span<PaintEntry>(&_paintEntries[0], kDefaultPaintEntries));
+        return arena;
+    }
+
+    void PaintSession::setPaintEntryBlock(std::span<PaintEntry> block)
+    {
+        _paintEntryBlockStart = block.data();
+        _nextFreePaintStruct = block.data();
+        // Two spare entries at the end (vanilla), one is required for the arranged list head
+        _endOfPaintStructArray = block.data() + block.size() - 2;
+    }
+
+    uint32_t PaintSession::getNumEntriesUsed() const
+    {
+        const auto usedBytes = reinterpret_cast<uintptr_t>(*_nextFreePaintStruct) - reinterpret_cast<uintptr_t>(_paintEntryBlockStart);
+        return _paintEntriesInPreviousBlocks + static_cast<uint32_t>((usedBytes + sizeof(PaintEntry) - 1) / sizeof(PaintEntry));
+    }
+
+    bool PaintSession::growPaintEntries()
+    {
+        auto block = _paintEntryArena->nextBlock();
+        if (block.empty())
+        {
+            _frameStatistics.numDropped++;
+            return false;
+        }
+        _frameStatistics.numOverflows++;
+        _paintEntriesInPreviousBlocks = getNumEntriesUsed();
+        setPaintEntryBlock(block);
+        return true;
+    }
+
     void PaintSession::init(Gfx::RenderTarget& rt, const SessionOptions& options)
+    {
+        init(rt, options, getDefaultArena());
+    }
+
+    void PaintSession::init(Gfx::RenderTarget& rt, const SessionOptions& options, PaintEntryArena& arena)
     {
         _renderTarget = &rt;
-        _nextFreePaintStruct = &_paintEntries[0];
-        _endOfPaintStructArray = &_paintEntries[3998];
+        _paintEntryArena = &arena;
+        _paintEntriesInPreviousBlocks = 0;
+        setPaintEntryBlock(arena.reset());
         _lastPS = nullptr;
         for (auto& quadrant : _quadrants)
         {
@@ -353,6 +437,12 @@ namespace OpenLoco::Paint
         return &_session;
     }
 
+    PaintSession* allocateSession(Gfx::RenderTarget& rt, const SessionOptions& options, PaintEntryArena& arena)
+    {
+        _session.init(rt, options, arena);
+        return &_session;
+    }
+
     static PaintStruct* addToPlotListTrackRoadHookHelper(registers& regs, uint8_t rotation)
     {
         PaintSession session;
@@ -927,6 +1017,9 @@ namespace OpenLoco::Paint
     // 0x0045E7B5
     void PaintSession::arrangeStructs()
     {
+        _frameStatistics.numSessions++;
+        _frameStatistics.peakEntries = std::max(_frameStatistics.peakEntries, getNumEntriesUsed());
+
         _paintHead = _nextFreePaintStruct;
         _nextFreePaintStruct++;
 
@@ -1147,19 +1240,30 @@ namespace OpenLoco::Paint
         }
     }
 
+    ArrangedSession PaintSession::getArrangedSession() const
+    {
+        return ArrangedSession{ _renderTarget, &(*_paintHead)->basic, _paintStringHead, _viewFlags };
+    }
+
     // 0x0045EA23
     void PaintSession::drawStructs()
     {
-        Gfx::RenderTarget& rt = **_renderTarget;
+        drawStructs(getArrangedSession());
+    }
+
+    void PaintSession::drawStructs(const ArrangedSession& arranged)
+    {
+        Gfx::RenderTarget& rt = *arranged.rt;
+        const auto viewFlags = arranged.viewFlags;
         auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
 
-        for (const auto* ps = (*_paintHead)->basic.nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
+        for (const auto* ps = arranged.head->nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
         {
-            const bool shouldCull = shouldTryCullPaintStruct(*ps, _viewFlags);
+            const bool shouldCull = shouldTryCullPaintStruct(*ps, viewFlags);
 
             if (shouldCull)
             {
-                if (cullPaintStructImage(ps->imageId, _viewFlags))
+                if (cullPaintStructImage(ps->imageId, viewFlags))
                 {
                     continue;
                 }
@@ -1171,11 +1275,11 @@ namespace OpenLoco::Paint
             for (const auto* childPs = ps->children; childPs != nullptr; childPs = childPs->children)
             {
                 // assert(childPs->attachedPS == nullptr); Children can have attachments but we are skipping them to be investigated!
-                const bool shouldCullChild = shouldTryCullPaintStruct(*childPs, _viewFlags);
+                const bool shouldCullChild = shouldTryCullPaintStruct(*childPs, viewFlags);
 
                 if (shouldCullChild)
                 {
-                    if (cullPaintStructImage(childPs->imageId, _viewFlags))
+                    if (cullPaintStructImage(childPs->imageId, viewFlags))
                     {
                         continue;
                     }
@@ -1187,10 +1291,10 @@ namespace OpenLoco::Paint
             // Draw any attachments to the struct
             for (const auto* attachPs = ps->attachedPS; attachPs != nullptr; attachPs = attachPs->next)
             {
-                const bool shouldCullAttach = shouldTryCullPaintStruct(*ps, _viewFlags);
+                const bool shouldCullAttach = shouldTryCullPaintStruct(*ps, viewFlags);
                 if (shouldCullAttach)
                 {
-                    if (cullPaintStructImage(attachPs->imageId, _viewFlags))
+                    if (cullPaintStructImage(attachPs->imageId, viewFlags))
                     {
                         continue;
                     }
@@ -1203,14 +1307,19 @@ namespace OpenLoco::Paint
     // 0x0045A60E
     void PaintSession::drawStringStructs()
     {
-        PaintStringStruct* psString = _paintStringHead;
+        drawStringStructs(getArrangedSession());
+    }
+
+    void PaintSession::drawStringStructs(const ArrangedSession& arranged)
+    {
+        PaintStringStruct* psString = arranged.stringHead;
         if (psString == nullptr)
         {
             return;
         }
 
-        Gfx::RenderTarget unZoomedRt = **(_renderTarget);
-        const auto zoom = (*_renderTarget)->zoomLevel;
+        Gfx::RenderTarget unZoomedRt = *arranged.rt;
+        const auto zoom = arranged.rt->zoomLevel;
 
         unZoomedRt.zoomLevel = 0;
         unZoomedRt.x >>= zoom;
@@ -6,7 +6,9 @@
 #include <OpenLoco/Engine/Ui/Point.hpp>
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <memory>
 #include <span>
+#include <vector>
 
 namespace OpenLoco::World
 {
@@ -175,6 +177,9 @@ namespace OpenLoco::Paint
         PaintStruct basic;
         AttachedPaintStruct attached;
         PaintStringStruct string;
+
+        // Left uninitialised, entries are zeroed when allocated
+        PaintEntry() {}
     };
     assert_struct_size(PaintEntry, 0x34);
 
@@ -245,7 +250,53 @@ namespace OpenLoco::Paint
         }
     };
 
+    // An arranged session detached from the global session state so that it can be drawn
+    // after another session has been generated. Only valid whilst its paint entries are not reused.
+    struct ArrangedSession
+    {
+        Gfx::RenderTarget* rt;
+        PaintStruct* head;
+        PaintStringStruct* stringHead;
+        Ui::ViewportFlags viewFlags;
+    };
+
     static constexpr auto kMaxPaintQuadrants = 1024;
+    static constexpr auto kDefaultPaintEntries = 4000;
+
+    // Bump allocated paint entries for sessions. Starts with an initial block and moves on to heap blocks
+    // when a session runs out. Blocks are kept for later sessions so only the first dense frame allocates.
+    class PaintEntryArena
+    {
+    public:
+        static constexpr size_t kBlockSize = kDefaultPaintEntries;
+        static constexpr size_t kMaxBlocks = 16;
+
+    private:
+        std::span<PaintEntry> _initialBlock;
+        std::vector<std::unique_ptr<PaintEntry[]>> _blocks;
+        size_t _nextBlock = 0;
+
+    public:
+        // Without an initial block the first heap block is used
+        PaintEntryArena() = default;
+        explicit PaintEntryArena(std::span<PaintEntry> initialBlock)
+            : _initialBlock(initialBlock)
+        {
+        }
+
+        // Starts again from the first block, entries from before are reused
+        std::span<PaintEntry> reset();
+        // Returns an empty span once the arena has reached kMaxBlocks
+        std::span<PaintEntry> nextBlock();
+    };
+
+    struct PaintStatistics
+    {
+        uint32_t numSessions;  // Sessions arranged
+        uint32_t peakEntries;  // Most entries used by a single session
+        uint32_t numOverflows; // Times a session ran out of a block and moved to the next
+        uint32_t numDropped;   // Paint structs dropped as the arena could not grow
+    };
 
     struct PaintSession
     {
@@ -255,6 +306,11 @@ namespace OpenLoco::Paint
         void drawStructs();
         void drawStringStructs();
         void init(Gfx::RenderTarget& rt, const SessionOptions& options);
+        void init(Gfx::RenderTarget& rt, const SessionOptions& options, PaintEntryArena& arena);
+        ArrangedSession getArrangedSession() const;
+        // Thread safe as long as each arranged session has its own render target
+        static void drawStructs(const ArrangedSession& arranged);
+        static void drawStringStructs(const ArrangedSession& arranged);
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getNormalInteractionInfo(const Ui::ViewportInteraction::InteractionItemFlags flags);
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getStationNameInteractionInfo(const Ui::ViewportInteraction::InteractionItemFlags flags);
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getTownNameInteractionInfo(const Ui::ViewportInteraction::InteractionItemFlags flags);
@@ -430,7 +486,10 @@ namespace OpenLoco::Paint
         inline static Interop::loco_global<PaintEntry*, 0x00E0C404> _endOfPaintStructArray;
         inline static Interop::loco_global<PaintEntry*, 0x00E0C408> _paintHead;
         inline static Interop::loco_global<PaintEntry*, 0x00E0C40C> _nextFreePaintStruct;
-        inline static Interop::loco_global<PaintEntry[4000], 0x00E0C410> _paintEntries;
+        inline static Interop::loco_global<PaintEntry[kDefaultPaintEntries], 0x00E0C410> _paintEntries;
+        inline static PaintEntryArena* _paintEntryArena = nullptr;
+        inline static PaintEntry* _paintEntryBlockStart = nullptr;
+        inline static uint32_t _paintEntriesInPreviousBlocks = 0;
         inline static Interop::loco_global<coord_t, 0x00E3F090> _spritePositionX;
         inline static Interop::loco_global<coord_t, 0x00E3F092> _unkPositionX;
         inline static Interop::loco_global<int16_t, 0x00E3F094> _vpPositionX;
@@ -507,13 +566,22 @@ namespace OpenLoco::Paint
         // Map::TileElement* trackElementOnSameHeight;
         // uint8_t unk141E9DB;
         // uint32_t trackColours[4];
+        static PaintEntryArena& getDefaultArena();
+        void setPaintEntryBlock(std::span<PaintEntry> block);
+        uint32_t getNumEntriesUsed() const;
+        bool growPaintEntries();
+
         template<typename T>
         T* allocatePaintStruct()
         {
             auto* ps = *_nextFreePaintStruct;
             if (ps >= *_endOfPaintStructArray)
             {
-                return nullptr;
+                if (!growPaintEntries())
+                {
+                    return nullptr;
+                }
+                ps = *_nextFreePaintStruct;
             }
             *_nextFreePaintStruct = reinterpret_cast<PaintEntry*>(reinterpret_cast<uintptr_t>(*_nextFreePaintStruct) + sizeof(T));
             auto* specificPs = reinterpret_cast<T*>(ps);
@@ -526,6 +594,13 @@ namespace OpenLoco::Paint
     };
 
     PaintSession* allocateSession(Gfx::RenderTarget& rt, const SessionOptions& options);
+    // Allocates the session into the provided arena rather than the global one. The arranged structs remain
+    // valid until the arena is used by another session.
+    PaintSession* allocateSession(Gfx::RenderTarget& rt, const SessionOptions& options, PaintEntryArena& arena);
+
+    // Statistics are collected for each frame, endFrame starts the next one
+    void endFrame();
+    const PaintStatistics& getLastFrameStatistics();
 
     void registerHooks();
 }
@@ -8,6 +8,7 @@
 #include "Effects/SmokeEffect.h"
 #include "Effects/SplashEffect.h"
 #include "Effects/VehicleCrashEffect.h"
+#include "Entities/EntityTweener.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/ImageIds.h"
 #include "Graphics/RenderTarget.h"
@@ -54,6 +55,7 @@ namespace OpenLoco::Paint
     // 0x00440331
     static void paintExhaustEntity(PaintSession& session, Exhaust* exhaustEntity)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*exhaustEntity).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 1)
         {
@@ -66,17 +68,18 @@ namespace OpenLoco::Paint
 
         if (!steamObject->hasFlags(SteamObjectFlags::unk3))
         {
-            session.addToPlotListAsParent(imageId, { 0, 0, exhaustEntity->position.z }, { 1, 1, 0 });
+            session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
         }
         else
         {
-            session.addToPlotListAsParent(imageId, { 0, 0, exhaustEntity->position.z }, { -12, -12, exhaustEntity->position.z }, { 24, 24, 0 });
+            session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { -12, -12, renderZ }, { 24, 24, 0 });
         }
     }
 
     // 0x004403C5
     static void paintRedGreenCurrencyEntity(PaintSession& session, MoneyEffect* moneyEffect)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*moneyEffect).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 1)
         {
@@ -86,12 +89,13 @@ namespace OpenLoco::Paint
         uint32_t currencyAmount = abs(moneyEffect->amount);
         const int8_t* yOffsets = &kWiggleYOffsets[moneyEffect->wiggle];
 
-        session.addToStringPlotList(currencyAmount, stringId, moneyEffect->position.z, moneyEffect->offsetX, yOffsets, 0);
+        session.addToStringPlotList(currencyAmount, stringId, renderZ, moneyEffect->offsetX, yOffsets, 0);
     }
 
     // 0x00440400
     static void paintWindowCurrencyEntity(PaintSession& session, MoneyEffect* moneyEffect)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*moneyEffect).z;
         if (!Config::get().cashPopupRendering)
         {
             return;
@@ -107,12 +111,13 @@ namespace OpenLoco::Paint
         const int8_t* yOffsets = &kWiggleYOffsets[moneyEffect->wiggle];
         auto companyColour = CompanyManager::getCompanyColour(moneyEffect->var_2E);
 
-        session.addToStringPlotList(currencyAmount, stringId, moneyEffect->position.z, moneyEffect->offsetX, yOffsets, enumValue(companyColour));
+        session.addToStringPlotList(currencyAmount, stringId, renderZ, moneyEffect->offsetX, yOffsets, enumValue(companyColour));
     }
 
     // 0x0044044E
     static void paintVehicleCrashParticleEntity(PaintSession& session, VehicleCrashParticle* particle)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*particle).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel != 0)
         {
@@ -132,12 +137,13 @@ namespace OpenLoco::Paint
 
         const auto imageId = ImageId{ kVehicleCrashParticleImageIds.at(particle->crashedSpriteBase).at(particle->frame / 256), particle->colourScheme };
 
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
     }
 
     // 0x0044051C
     static void paintExplosionCloudEntity(PaintSession& session, ExplosionCloud* particle)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*particle).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 2)
         {
@@ -167,12 +173,13 @@ namespace OpenLoco::Paint
 
         assert(static_cast<size_t>(particle->frame / 256) < kExplosionCloudImageIds.size());
         const auto imageId = ImageId{ kExplosionCloudImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
     }
 
     // 0x00440557
     static void paintSplashEntity(PaintSession& session, Splash* particle)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*particle).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 2)
         {
@@ -212,12 +219,13 @@ namespace OpenLoco::Paint
 
         assert(static_cast<size_t>(particle->frame / 256) < kSplashImageIds.size());
         const auto imageId = ImageId{ kSplashImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
     }
 
     // 0x00440592
     static void paintFireballEntity(PaintSession& session, Fireball* particle)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*particle).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 2)
         {
@@ -260,12 +268,13 @@ namespace OpenLoco::Paint
 
         assert(static_cast<size_t>(particle->frame / 256) < kFireballImageIds.size());
         const auto imageId = ImageId{ kFireballImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
     }
 
     // 0x004404A6
     static void paintExplosionSmokeEntity(PaintSession& session, ExplosionSmoke* particle)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*particle).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 1)
         {
@@ -287,12 +296,13 @@ namespace OpenLoco::Paint
 
         assert(static_cast<size_t>(particle->frame / 256) < kExplosionSmokeImageIds.size());
         const auto imageId = ImageId{ kExplosionSmokeImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
     }
 
     // 0x004404E1
     static void paintSmokeEntity(PaintSession& session, Smoke* particle)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*particle).z;
         Gfx::RenderTarget* rt = session.getRenderTarget();
         if (rt->zoomLevel > 1)
         {
@@ -316,7 +326,7 @@ namespace OpenLoco::Paint
 
         assert(static_cast<size_t>(particle->frame / 256) < kSmokeImageIds.size());
         const auto imageId = ImageId{ kSmokeImageIds.at(particle->frame / 256) };
-        session.addToPlotListAsParent(imageId, { 0, 0, particle->position.z }, { 1, 1, 0 });
+        session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { 1, 1, 0 });
     }
 
     // 0x00440325
@@ -2,6 +2,7 @@
 #include "Config.h"
 #include "Effects/Effect.h"
 #include "Entities/EntityManager.h"
+#include "Entities/EntityTweener.h"
 #include "Map/Tile.h"
 #include "Paint.h"
 #include "PaintEffectEntity.h"
@@ -60,7 +61,7 @@ namespace OpenLoco::Paint
                 continue;
             }
             session.setCurrentItem(entity);
-            session.setEntityPosition(entity->position);
+            session.setEntityPosition(EntityTweener::get().getRenderPosition(*entity));
             session.setItemType(InteractionItem::entity);
             switch (entity->baseType)
             {
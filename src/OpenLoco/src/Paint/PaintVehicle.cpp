@@ -1,5 +1,6 @@
 #include "PaintVehicle.h"
 #include "Config.h"
+#include "Entities/EntityTweener.h"
 #include "Graphics/Colour.h"
 #include "Objects/ObjectManager.h"
 #include "Objects/VehicleObject.h"
@@ -38,6 +39,7 @@ namespace OpenLoco::Paint
     // 0x004B0CFC
     static void paintBogie(PaintSession& session, VehicleBogie* bogie)
     {
+        const auto renderZ = EntityTweener::get().getRenderPosition(*bogie).z;
         auto* vehObject = ObjectManager::get<VehicleObject>(bogie->objectId);
         if (bogie->objectSpriteType == SpriteIndex::null)
         {
@@ -106,7 +108,7 @@ namespace OpenLoco::Paint
                     }
                     session.setItemType(Ui::ViewportInteraction::InteractionItem::noInteraction);
                     imageId = ImageId(imageIndex).withTranslucency(ExtColour::unk32);
-                    session.addToPlotList4FD200(imageId, { 0, 0, bogie->position.z }, { 8, 8, static_cast<coord_t>(bogie->position.z + 6) }, { 48, 48, 2 });
+                    session.addToPlotList4FD200(imageId, { 0, 0, renderZ }, { 8, 8, static_cast<coord_t>(renderZ + 6) }, { 48, 48, 2 });
                     return;
                 }
                 else
@@ -117,12 +119,12 @@ namespace OpenLoco::Paint
                 if (sprite.hasFlags(BogieSpriteFlags::unk_4))
                 {
                     // larger sprite
-                    session.addToPlotListAsParent(imageId, { 0, 0, bogie->position.z }, { -9, -9, static_cast<coord_t>(bogie->position.z + 3) }, { 18, 18, 5 });
+                    session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { -9, -9, static_cast<coord_t>(renderZ + 3) }, { 18, 18, 5 });
                 }
                 else
                 {
                     // smaller sprite
-                    session.addToPlotListAsParent(imageId, { 0, 0, bogie->position.z }, { -6, -6, static_cast<coord_t>(bogie->position.z + 3) }, { 12, 12, 1 });
+                    session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { -6, -6, static_cast<coord_t>(renderZ + 3) }, { 12, 12, 1 });
                 }
                 break;
             }
@@ -145,12 +147,12 @@ namespace OpenLoco::Paint
                 if (sprite.hasFlags(BogieSpriteFlags::unk_4))
                 {
                     // larger sprite
-                    session.addToPlotListAsParent(imageId, { 0, 0, bogie->position.z }, { -8, -8, static_cast<coord_t>(bogie->position.z + 3) }, { 16, 16, 1 });
+                    session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { -8, -8, static_cast<coord_t>(renderZ + 3) }, { 16, 16, 1 });
                 }
                 else
                 {
                     // smaller sprite
-                    session.addToPlotListAsParent(imageId, { 0, 0, bogie->position.z }, { -6, -6, static_cast<coord_t>(bogie->position.z + 3) }, { 12, 12, 1 });
+                    session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { -6, -6, static_cast<coord_t>(renderZ + 3) }, { 12, 12, 1 });
                 }
                 break;
             }
@@ -167,7 +169,7 @@ namespace OpenLoco::Paint
                 {
                     imageId = ImageId(imageIndex, bogie->colourScheme);
                 }
-                session.addToPlotListAsParent(imageId, { 0, 0, bogie->position.z }, { -6, -6, static_cast<coord_t>(bogie->position.z + 3) }, { 12, 12, 1 });
+                session.addToPlotListAsParent(imageId, { 0, 0, renderZ }, { -6, -6, static_cast<coord_t>(renderZ + 3) }, { 12, 12, 1 });
                 break;
             }
         }
@@ -333,6 +335,8 @@ namespace OpenLoco::Paint
         static loco_global<World::Pos2[64], 0x00503B6A> _503B6A; // also used in vehicle.cpp
         static loco_global<int8_t[32 * 4], 0x005001B4> _5001B4;  // array of 4 byte structures
 
+        const auto renderZ = EntityTweener::get().getRenderPosition(*body).z;
+
         auto* vehObject = ObjectManager::get<VehicleObject>(body->objectId);
         if (body->objectSpriteType == SpriteIndex::null)
         {
@@ -393,12 +397,12 @@ namespace OpenLoco::Paint
             brakingImageIndex = getBrakingImageIndex(pitchImageIndex, sprite);
         }
 
-        World::Pos3 offsets = { 0, 0, body->position.z };
+        World::Pos3 offsets = { 0, 0, renderZ };
         World::Pos3 boundBoxOffsets;
         World::Pos3 boundBoxSize;
         if ((body->getTransportMode() == TransportMode::air) || (body->getTransportMode() == TransportMode::water))
         {
-            boundBoxOffsets = { -8, -8, static_cast<int16_t>(body->position.z + 11) };
+            boundBoxOffsets = { -8, -8, static_cast<int16_t>(renderZ + 11) };
             boundBoxSize = { 48, 48, 15 };
         }
         else
@@ -421,7 +425,7 @@ namespace OpenLoco::Paint
             originalYaw &= 0x1F;
             boundBoxOffsets.x += (_5001B4[originalYaw * 4] * offsetModifier) >> 8;
             boundBoxOffsets.y += (_5001B4[originalYaw * 4 + 1] * offsetModifier) >> 8;
-            boundBoxOffsets.z = body->position.z + 11;
+            boundBoxOffsets.z = renderZ + 11;
             boundBoxSize = {
                 static_cast<coord_t>((_5001B4[originalYaw * 4 + 2] * offsetModifier) >> 8),
                 static_cast<coord_t>((_5001B4[originalYaw * 4 + 3] * offsetModifier) >> 8),
@@ -12,6 +12,7 @@
 #include "Localisation/Formatting.h"
 #include "Localisation/StringIds.h"
 #include "Localisation/StringManager.h"
+#include "Map/AnimationManager.h"
 #include "Map/TileManager.h"
 #include "Objects/ObjectIndex.h"
 #include "Objects/ObjectManager.h"
@@ -22,6 +23,7 @@
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
+#include "Vehicles/Vehicle.h"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
@@ -33,7 +35,9 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/Exception.hpp>
 #include <fstream>
+#include <future>
 #include <iomanip>
+#include <optional>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -56,7 +60,17 @@ namespace OpenLoco::S5
     // TODO: move this?
     static std::vector<ObjectHeader> _loadErrorObjectsList;
 
-    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects);
+    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags);
+    static void writeGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags);
+
+    // A save being written on a background thread
+    struct PendingExport
+    {
+        std::future<std::string> result; // Empty on success otherwise the error message
+        SaveFlags flags;
+        std::function<void(bool)> onComplete;
+    };
+    static std::optional<PendingExport> _pendingExport;
 
     constexpr bool hasSaveFlags(SaveFlags flags, SaveFlags flagsToTest)
     {
@@ -238,9 +252,9 @@ namespace OpenLoco::S5
         file->gameState.savedViewRotation = savedView.rotation;
         file->gameState.magicNumber = kMagicNumber; // Match implementation at 0x004437FC
 
-        auto tileElements = TileManager::getElements();
+        const auto tileElements = TileManager::getElementsInMapOrder();
         file->tileElements.resize(tileElements.size());
-        std::memcpy(file->tileElements.data(), tileElements.data(), tileElements.size_bytes());
+        std::memcpy(file->tileElements.data(), tileElements.data(), tileElements.size() * sizeof(World::TileElement));
         removeGhostElements(file->tileElements);
         return file;
     }
@@ -253,14 +267,9 @@ namespace OpenLoco::S5
             && !isNetworked();
     }
 
-    // 0x00441C26
-    bool exportGameStateToFile(const fs::path& path, SaveFlags flags)
-    {
-        FileStream fs(path, StreamMode::write);
-        return exportGameStateToFile(fs, flags);
-    }
-
-    bool exportGameStateToFile(Stream& stream, SaveFlags flags)
+    // Tidies up the live game state and takes a copy of it to be saved. The copy of the tile elements is always
+    // in map order, reorganiseTiles also packs the live elements like vanilla saving does.
+    static std::unique_ptr<S5File> snapshotGameState(SaveFlags flags, std::vector<ObjectHeader>& packedObjects, bool reorganiseTiles)
     {
         if ((flags & SaveFlags::noWindowClose) == SaveFlags::none
             && (flags & SaveFlags::raw) == SaveFlags::none
@@ -271,26 +280,53 @@ namespace OpenLoco::S5
 
         if ((flags & SaveFlags::raw) == SaveFlags::none)
         {
-            TileManager::reorganise();
+            if (reorganiseTiles)
+            {
+                TileManager::reorganise();
+            }
             EntityManager::resetSpatialIndex();
             EntityManager::zeroUnused();
             StationManager::zeroUnused();
             Vehicles::OrderManager::zeroUnusedOrderTable();
         }
 
+        auto requiredObjects = ObjectManager::getHeaders();
+        if (shouldPackObjects(flags))
+        {
+            std::copy_if(requiredObjects.begin(), requiredObjects.end(), std::back_inserter(packedObjects), [](ObjectHeader& header) {
+                return !header.isEmpty() && !header.isVanilla();
+            });
+        }
+
+        return prepareGameState(flags, requiredObjects, packedObjects);
+    }
+
+    static void onExportSucceeded(SaveFlags flags)
+    {
+        Gfx::invalidateScreen();
+        if ((flags & SaveFlags::raw) == SaveFlags::none)
+        {
+            resetScreenAge();
+        }
+    }
+
+    // 0x00441C26
+    bool exportGameStateToFile(const fs::path& path, SaveFlags flags)
+    {
+        // A background save may still be writing to the same path
+        pollPendingExport(true);
+
+        FileStream fs(path, StreamMode::write);
+        return exportGameStateToFile(fs, flags);
+    }
+
+    bool exportGameStateToFile(Stream& stream, SaveFlags flags)
+    {
         bool saveResult;
         {
-            auto requiredObjects = ObjectManager::getHeaders();
             std::vector<ObjectHeader> packedObjects;
-            if (shouldPackObjects(flags))
-            {
-                std::copy_if(requiredObjects.begin(), requiredObjects.end(), std::back_inserter(packedObjects), [](ObjectHeader& header) {
-                    return !header.isEmpty() && !header.isVanilla();
-                });
-            }
-
-            auto file = prepareGameState(flags, requiredObjects, packedObjects);
-            saveResult = exportGameState(stream, *file, packedObjects);
+            auto file = snapshotGameState(flags, packedObjects, true);
+            saveResult = exportGameState(stream, *file, packedObjects, flags);
         }
 
         if ((flags & SaveFlags::raw) == SaveFlags::none
@@ -301,59 +337,109 @@ namespace OpenLoco::S5
 
         if (saveResult)
         {
-            Gfx::invalidateScreen();
-            if ((flags & SaveFlags::raw) == SaveFlags::none)
-            {
-                resetScreenAge();
-            }
-
+            onExportSucceeded(flags);
             return true;
         }
 
         return false;
     }
 
-    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects)
+    // Written to a temporary file first so that an existing save is only replaced by a complete one
+    static void writeGameStateToFileAtomic(const fs::path& path, const S5File& file, SaveFlags flags)
     {
+        auto tempPath = path;
+        tempPath += ".tmp";
         try
         {
-            SawyerStreamWriter fs(stream);
-            fs.writeChunk(SawyerEncoding::rotate, file.header);
-            if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
-            {
-                fs.writeChunk(SawyerEncoding::rotate, *file.landscapeOptions);
-            }
-            if (file.header.hasFlags(HeaderFlags::hasSaveDetails))
             {
-                fs.writeChunk(SawyerEncoding::rotate, *file.saveDetails);
+                FileStream stream(tempPath, StreamMode::write);
+                writeGameState(stream, file, {}, flags);
             }
-            if (file.header.numPackedObjects != 0)
-            {
-                ObjectManager::writePackedObjects(fs, packedObjects);
-            }
-            fs.writeChunk(SawyerEncoding::rotate, file.requiredObjects, sizeof(file.requiredObjects));
+            fs::rename(tempPath, path);
+        }
+        catch (...)
+        {
+            std::error_code ec;
+            fs::remove(tempPath, ec);
+            throw;
+        }
+    }
 
-            if (file.header.type == S5Type::scenario)
-            {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.rng, 0xB96C);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.towns, 0x123480);
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState.animations, 0x79D80);
-            }
-            else
+    void exportGameStateToFileAsync(const fs::path& path, SaveFlags flags, std::function<void(bool)> onComplete)
+    {
+        // Only one background save at a time
+        pollPendingExport(true);
+
+        // Packing objects reads the loaded objects so can not be done off the main thread
+        if (shouldPackObjects(flags))
+        {
+            const auto result = exportGameStateToFile(path, flags);
+            if (onComplete)
             {
-                fs.writeChunk(SawyerEncoding::runLengthSingle, file.gameState);
+                onComplete(result);
             }
+            return;
+        }
+
+        // Reorganising would stall the game, the snapshot is put in map order without changing the live map instead
+        std::vector<ObjectHeader> packedObjects;
+        auto file = snapshotGameState(flags, packedObjects, false);
+
+        if ((flags & SaveFlags::raw) == SaveFlags::none
+            && (flags & SaveFlags::dump) == SaveFlags::none)
+        {
+            ObjectManager::reloadAll();
+        }
 
-            if (file.header.hasFlags(HeaderFlags::isRaw))
+        auto result = std::async(std::launch::async, [path, file = std::move(file), flags]() -> std::string {
+            try
             {
-                throw Exception::NotImplemented();
+                writeGameStateToFileAtomic(path, *file, flags);
+                return {};
             }
-            else
+            catch (const std::exception& e)
             {
-                fs.writeChunk(SawyerEncoding::runLengthMulti, file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+                return e.what();
             }
+        });
+        _pendingExport = PendingExport{ std::move(result), flags, std::move(onComplete) };
+    }
+
+    void pollPendingExport(bool wait)
+    {
+        if (!_pendingExport.has_value())
+        {
+            return;
+        }
+        if (!wait && _pendingExport->result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            return;
+        }
+
+        const auto error = _pendingExport->result.get();
+        const auto flags = _pendingExport->flags;
+        const auto onComplete = std::move(_pendingExport->onComplete);
+        _pendingExport.reset();
+
+        if (error.empty())
+        {
+            onExportSucceeded(flags);
+        }
+        else
+        {
+            Logging::error("Unable to save S5: {}", error);
+        }
+        if (onComplete)
+        {
+            onComplete(error.empty());
+        }
+    }
 
-            fs.writeChecksum();
+    static bool exportGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags)
+    {
+        try
+        {
+            writeGameState(stream, file, packedObjects, flags);
             return true;
         }
         catch (const std::exception& e)
@@ -363,6 +449,52 @@ namespace OpenLoco::S5
         }
     }
 
+    static void writeGameState(Stream& stream, const S5File& file, const std::vector<ObjectHeader>& packedObjects, SaveFlags flags)
+    {
+        const auto uncompressed = (flags & SaveFlags::uncompressed) != SaveFlags::none;
+        const auto encoding = [uncompressed](SawyerEncoding chunkEncoding) {
+            return uncompressed ? SawyerEncoding::uncompressed : chunkEncoding;
+        };
+
+        SawyerStreamWriter fs(stream);
+        fs.writeChunk(encoding(SawyerEncoding::rotate), file.header);
+        if (file.header.type == S5Type::scenario || file.header.type == S5Type::landscape)
+        {
+            fs.writeChunk(encoding(SawyerEncoding::rotate), *file.landscapeOptions);
+        }
+        if (file.header.hasFlags(HeaderFlags::hasSaveDetails))
+        {
+            fs.writeChunk(encoding(SawyerEncoding::rotate), *file.saveDetails);
+        }
+        if (file.header.numPackedObjects != 0)
+        {
+            ObjectManager::writePackedObjects(fs, packedObjects);
+        }
+        fs.writeChunk(encoding(SawyerEncoding::rotate), file.requiredObjects, sizeof(file.requiredObjects));
+
+        if (file.header.type == S5Type::scenario)
+        {
+            fs.writeChunk(encoding(SawyerEncoding::runLengthSingle), file.gameState.rng, 0xB96C);
+            fs.writeChunk(encoding(SawyerEncoding::runLengthSingle), file.gameState.towns, 0x123480);
+            fs.writeChunk(encoding(SawyerEncoding::runLengthSingle), file.gameState.animations, 0x79D80);
+        }
+        else
+        {
+            fs.writeChunk(encoding(SawyerEncoding::runLengthSingle), file.gameState);
+        }
+
+        if (file.header.hasFlags(HeaderFlags::isRaw))
+        {
+            throw Exception::NotImplemented();
+        }
+        else
+        {
+            fs.writeChunk(encoding(SawyerEncoding::runLengthMulti), file.tileElements.data(), file.tileElements.size() * sizeof(TileElement));
+        }
+
+        fs.writeChecksum();
+    }
+
     // 0x00445A4A
     static void fixState(GameState& state)
     {
@@ -670,6 +802,12 @@ namespace OpenLoco::S5
                 World::TileManager::initialise();
                 Scenario::sub_46115C();
             }
+            Vehicles::invalidateTrackNetworkCache();
+            CompanyManager::rebuildOccupancy();
+            IndustryManager::rebuildOccupancy();
+            StationManager::rebuildOccupancy();
+            TownManager::rebuildOccupancy();
+            World::AnimationManager::rebuildIndex();
             if (hasLoadFlags(flags, LoadFlags::landscape))
             {
                 EntityManager::freeUserStrings();
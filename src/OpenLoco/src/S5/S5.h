@@ -8,6 +8,7 @@
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <OpenLoco/Core/FileSystem.hpp>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -441,6 +442,7 @@ namespace OpenLoco::S5
         packCustomObjects = 1U << 0,
         scenario = 1U << 1,
         landscape = 1U << 2,
+        uncompressed = 1U << 3, // Chunks are written without encoding, for data that is compressed afterwards
         noWindowClose = 1U << 29,
         raw = 1U << 30,  // Save raw data including pointers with no clean up
         dump = 1U << 31, // Used for dumping the game state when there is a fatal error
@@ -456,6 +458,11 @@ namespace OpenLoco::S5
     Options& getOptions();
     bool exportGameStateToFile(const fs::path& path, SaveFlags flags);
     bool exportGameStateToFile(Stream& stream, SaveFlags flags);
+    // Takes a snapshot of the game state and writes it on a background thread. onComplete is called
+    // from pollPendingExport on the main thread. Saves that pack objects are written synchronously.
+    void exportGameStateToFileAsync(const fs::path& path, SaveFlags flags, std::function<void(bool)> onComplete = nullptr);
+    // Finishes a background save if it has completed, or waits for it to complete if wait is set
+    void pollPendingExport(bool wait = false);
     void registerHooks();
 
     const std::vector<ObjectHeader>& getObjectErrorList();
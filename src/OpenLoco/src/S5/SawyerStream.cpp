@@ -1,11 +1,18 @@
 #include "SawyerStream.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cstring>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define OPENLOCO_SAWYER_SSE2
+#include <emmintrin.h>
+#endif
 
 using namespace OpenLoco;
 
@@ -14,6 +21,90 @@ constexpr const char* exceptionWriteError = "Failed to write data to stream";
 constexpr const char* exceptionInvalidRLE = "Invalid RLE run";
 constexpr const char* exceptionUnknownEncoding = "Unknown encoding";
 
+// Each byte is rotated right by R0, R1, R2, R3 repeating every 4 bytes (the rotate encoding key)
+template<uint8_t R0, uint8_t R1, uint8_t R2, uint8_t R3>
+static void rotateBytesRight(std::byte* dst, const std::byte* src, size_t len)
+{
+    size_t i = 0;
+#ifdef OPENLOCO_SAWYER_SSE2
+    // SSE2 has no byte shifts so shift 16 bit lanes and mask off the bits that crossed into the neighbouring byte
+    const auto rotateLane = [](__m128i value, auto rotation, int32_t laneMask) {
+        constexpr int32_t kRotation = decltype(rotation)::value;
+        const auto lo = _mm_and_si128(_mm_srli_epi16(value, kRotation), _mm_set1_epi8(static_cast<char>(0xFF >> kRotation)));
+        const auto hi = _mm_and_si128(_mm_slli_epi16(value, 8 - kRotation), _mm_set1_epi8(static_cast<char>(0xFF << (8 - kRotation))));
+        return _mm_and_si128(_mm_or_si128(lo, hi), _mm_set1_epi32(laneMask));
+    };
+    for (; i + 16 <= len; i += 16)
+    {
+        const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        auto result = rotateLane(value, std::integral_constant<int32_t, R0>{}, 0x000000FF);
+        result = _mm_or_si128(result, rotateLane(value, std::integral_constant<int32_t, R1>{}, 0x0000FF00));
+        result = _mm_or_si128(result, rotateLane(value, std::integral_constant<int32_t, R2>{}, 0x00FF0000));
+        result = _mm_or_si128(result, rotateLane(value, std::integral_constant<int32_t, R3>{}, static_cast<int32_t>(0xFF000000)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), result);
+    }
+#else
+    // Same as above but 8 bytes at a time within a 64 bit integer
+    constexpr auto rotateLane = [](uint64_t value, uint8_t rotation, uint64_t laneMask) {
+        const auto lo = (value >> rotation) & (0x0101010101010101ULL * (0xFFU >> rotation));
+        const auto hi = (value << (8 - rotation)) & (0x0101010101010101ULL * ((0xFFU << (8 - rotation)) & 0xFFU));
+        return (lo | hi) & laneMask;
+    };
+    for (; i + 8 <= len; i += 8)
+    {
+        uint64_t value;
+        std::memcpy(&value, src + i, sizeof(value));
+        const auto result = rotateLane(value, R0, 0x000000FF000000FFULL)
+            | rotateLane(value, R1, 0x0000FF000000FF00ULL)
+            | rotateLane(value, R2, 0x00FF000000FF0000ULL)
+            | rotateLane(value, R3, 0xFF000000FF000000ULL);
+        std::memcpy(dst + i, &result, sizeof(result));
+    }
+#endif
+    constexpr std::array<uint8_t, 4> kRotations = { R0, R1, R2, R3 };
+    for (; i < len; i++)
+    {
+        dst[i] = static_cast<std::byte>(std::rotr(static_cast<uint8_t>(src[i]), kRotations[i % 4]));
+    }
+}
+
+// Additive checksum of all bytes as used at the end of Sawyer files
+static uint32_t addBytes(uint32_t checksum, const std::byte* data, size_t len)
+{
+    size_t i = 0;
+#ifdef OPENLOCO_SAWYER_SSE2
+    // sad against zero sums each group of 8 bytes into a 64 bit lane
+    const auto zero = _mm_setzero_si128();
+    auto sums = zero;
+    for (; i + 16 <= len; i += 16)
+    {
+        const auto value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(value, zero));
+    }
+    checksum += static_cast<uint32_t>(_mm_cvtsi128_si32(sums));
+    checksum += static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(sums, 8)));
+#else
+    // Sum pairs of bytes into 16 bit lanes, folding the lanes before they can overflow
+    constexpr size_t kMaxBlocksPerFold = 128;
+    while (i + 8 <= len)
+    {
+        uint64_t sums = 0;
+        for (size_t block = 0; block < kMaxBlocksPerFold && i + 8 <= len; block++, i += 8)
+        {
+            uint64_t value;
+            std::memcpy(&value, data + i, sizeof(value));
+            sums += (value & 0x00FF00FF00FF00FFULL) + ((value >> 8) & 0x00FF00FF00FF00FFULL);
+        }
+        checksum += static_cast<uint32_t>((sums & 0xFFFF) + ((sums >> 16) & 0xFFFF) + ((sums >> 32) & 0xFFFF) + (sums >> 48));
+    }
+#endif
+    for (; i < len; i++)
+    {
+        checksum += static_cast<uint8_t>(data[i]);
+    }
+    return checksum;
+}
+
 SawyerStreamReader::SawyerStreamReader(Stream& stream)
     : _stream(stream)
 {
@@ -67,15 +158,12 @@ bool SawyerStreamReader::validateChecksum()
         // Calculate checksum
         uint32_t actualChecksum = 0;
         _stream.setPosition(0);
-        uint8_t buffer[2048];
+        std::byte buffer[2048];
         for (uint32_t i = 0; i < fileLength - 4; i += sizeof(buffer))
         {
             auto readLength = std::min<size_t>(sizeof(buffer), fileLength - 4 - i);
             _stream.read(buffer, readLength);
-            for (size_t j = 0; j < readLength; j++)
-            {
-                actualChecksum += buffer[j];
-            }
+            actualChecksum = addBytes(actualChecksum, buffer, readLength);
         }
 
         valid = checksum == actualChecksum;
@@ -117,16 +205,11 @@ std::span<const std::byte> SawyerStreamReader::decode(SawyerEncoding encoding, s
     }
 }
 
-static void fillStream(MemoryStream& buffer, std::byte value, size_t count)
-{
-    for (size_t i = 0; i < count; i++)
-    {
-        buffer.writeValue(value);
-    }
-}
-
+// Both RLE decoders validate and size the output in a first pass so that the second pass can write
+// runs and literals in bulk straight into the buffer.
 void SawyerStreamReader::decodeRunLengthSingle(MemoryStream& buffer, std::span<const std::byte> data)
 {
+    size_t decodedLen = 0;
     for (size_t i = 0; i < data.size(); i++)
     {
         uint8_t rleCodeByte = static_cast<uint8_t>(data[i]);
@@ -137,10 +220,7 @@ void SawyerStreamReader::decodeRunLengthSingle(MemoryStream& buffer, std::span<c
             {
                 throw Exception::RuntimeError(exceptionInvalidRLE);
             }
-
-            auto copyLen = static_cast<size_t>(257 - rleCodeByte);
-            auto copyByte = data[i];
-            fillStream(buffer, copyByte, copyLen);
+            decodedLen += static_cast<size_t>(257 - rleCodeByte);
         }
         else
         {
@@ -148,16 +228,39 @@ void SawyerStreamReader::decodeRunLengthSingle(MemoryStream& buffer, std::span<c
             {
                 throw Exception::RuntimeError(exceptionInvalidRLE);
             }
+            decodedLen += static_cast<size_t>(rleCodeByte + 1);
+            i += rleCodeByte + 1;
+        }
+    }
 
+    const auto start = buffer.getLength();
+    buffer.resize(start + decodedLen);
+    auto* dst = buffer.data() + start;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        uint8_t rleCodeByte = static_cast<uint8_t>(data[i]);
+        if (rleCodeByte & 128)
+        {
+            i++;
+            auto copyLen = static_cast<size_t>(257 - rleCodeByte);
+            std::memset(dst, static_cast<uint8_t>(data[i]), copyLen);
+            dst += copyLen;
+        }
+        else
+        {
             auto copyLen = static_cast<size_t>(rleCodeByte + 1);
-            buffer.write(&data[i + 1], copyLen);
+            std::memcpy(dst, &data[i + 1], copyLen);
+            dst += copyLen;
             i += rleCodeByte + 1;
         }
     }
+    buffer.setPosition(buffer.getLength());
 }
 
 void SawyerStreamReader::decodeRunLengthMulti(MemoryStream& buffer, std::span<const std::byte> data)
 {
+    const auto start = buffer.getLength();
+    size_t decodedLen = 0;
     for (size_t i = 0; i < data.size(); i++)
     {
         if (data[i] == std::byte{ 0xFF })
@@ -167,37 +270,52 @@ void SawyerStreamReader::decodeRunLengthMulti(MemoryStream& buffer, std::span<co
             {
                 throw Exception::RuntimeError(exceptionInvalidRLE);
             }
-            buffer.writeValue(data[i]);
+            decodedLen++;
         }
         else
         {
             auto offset = static_cast<int32_t>(data[i] >> 3) - 32;
             assert(offset < 0);
-            if (static_cast<size_t>(-offset) > buffer.getLength())
+            if (static_cast<size_t>(-offset) > start + decodedLen)
             {
                 throw Exception::RuntimeError(exceptionInvalidRLE);
             }
-            auto copySrc = buffer.data() + buffer.getLength() + offset;
+            decodedLen += (static_cast<size_t>(data[i]) & 7) + 1;
+        }
+    }
+
+    buffer.resize(start + decodedLen);
+    auto* dst = buffer.data() + start;
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        if (data[i] == std::byte{ 0xFF })
+        {
+            i++;
+            *dst++ = data[i];
+        }
+        else
+        {
+            auto offset = static_cast<int32_t>(data[i] >> 3) - 32;
             auto copyLen = (static_cast<size_t>(data[i]) & 7) + 1;
 
-            // Copy it to temp buffer first as we can't copy buffer to itself due to potential
-            // realloc in between reserve and push
-            std::byte copyBuffer[32];
-            assert(copyLen <= sizeof(copyBuffer));
-            std::memcpy(copyBuffer, copySrc, copyLen);
-            buffer.write(copyBuffer, copyLen);
+            // Copy forwards a byte at a time as the source may overlap the bytes being written
+            const auto* copySrc = dst + offset;
+            for (size_t j = 0; j < copyLen; j++)
+            {
+                dst[j] = copySrc[j];
+            }
+            dst += copyLen;
         }
     }
+    buffer.setPosition(buffer.getLength());
 }
 
 void SawyerStreamReader::decodeRotate(MemoryStream& buffer, std::span<const std::byte> data)
 {
-    uint8_t code = 1;
-    for (size_t i = 0; i < data.size(); i++)
-    {
-        buffer.writeValue(std::rotr(static_cast<uint8_t>(data[i]), code));
-        code = (code + 2) & 7;
-    }
+    const auto start = buffer.getLength();
+    buffer.resize(start + data.size());
+    rotateBytesRight<1, 3, 5, 7>(buffer.data() + start, data.data(), data.size());
+    buffer.setPosition(buffer.getLength());
 }
 
 SawyerStreamWriter::SawyerStreamWriter(Stream& stream)
@@ -216,11 +334,7 @@ void SawyerStreamWriter::writeChunk(SawyerEncoding chunkType, const void* data,
 void SawyerStreamWriter::write(const void* data, size_t dataLen)
 {
     writeStream(data, dataLen);
-    auto data8 = reinterpret_cast<const uint8_t*>(data);
-    for (size_t i = 0; i < dataLen; i++)
-    {
-        _checksum += data8[i];
-    }
+    _checksum = addBytes(_checksum, static_cast<const std::byte*>(data), dataLen);
 }
 
 void SawyerStreamWriter::writeChecksum()
@@ -382,10 +496,9 @@ void SawyerStreamWriter::encodeRunLengthMulti(MemoryStream& buffer, std::span<co
 
 void SawyerStreamWriter::encodeRotate(MemoryStream& buffer, std::span<const std::byte> data)
 {
-    uint8_t code = 1;
-    for (size_t i = 0; i < data.size(); i++)
-    {
-        buffer.writeValue(std::rotl(static_cast<uint8_t>(data[i]), code));
-        code = (code + 2) & 7;
-    }
+    // Rotating left by 1, 3, 5, 7 is rotating right by 7, 5, 3, 1
+    const auto start = buffer.getLength();
+    buffer.resize(start + data.size());
+    rotateBytesRight<7, 5, 3, 1>(buffer.data() + start, data.data(), data.size());
+    buffer.setPosition(buffer.getLength());
 }
@@ -0,0 +1,372 @@
+#include "SimulateBatch.h"
+#include "Benchmark.h"
+#include "GameException.hpp"
+#include "GameSaveCompare.h"
+#include "GameState.h"
+#include "OpenLoco.h"
+#include "S5/S5.h"
+#include <OpenLoco/Core/EnumFlags.hpp>
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <fmt/format.h>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::SimulateBatch
+{
+    using ClockType = std::chrono::high_resolution_clock;
+
+    enum class Status : uint8_t
+    {
+        passed,
+        diverged,
+        failed,  // Unable to load or simulate
+        crashed, // Worker exited without reporting a result
+    };
+
+    static constexpr std::array<std::string_view, 4> kStatusNames = {
+        "passed",
+        "diverged",
+        "failed",
+        "crashed",
+    };
+
+    struct Job
+    {
+        fs::path savePath;
+        fs::path expectedPath;
+    };
+
+    // Sent from a worker to the batch process through a pipe
+    struct Result
+    {
+        Status status;
+        uint32_t scenarioTicks;
+        std::array<uint32_t, 2> rng;
+        double durationMs;
+    };
+
+    static bool isSaveFile(const fs::path& path)
+    {
+        const auto extension = path.extension().u8string();
+        return Utility::iequals(extension, S5::extensionSV5) || Utility::iequals(extension, S5::extensionSC5);
+    }
+
+    static std::vector<Job> findJobsInDirectory(const fs::path& directory)
+    {
+        const auto expectedDirectory = directory / "expected";
+
+        std::vector<Job> jobs;
+        for (const auto& file : fs::directory_iterator(directory, fs::directory_options::skip_permission_denied))
+        {
+            if (!file.is_regular_file() || !isSaveFile(file.path()))
+            {
+                continue;
+            }
+
+            auto& job = jobs.emplace_back(Job{ file.path(), {} });
+            auto expectedPath = expectedDirectory / file.path().filename();
+            if (fs::is_regular_file(expectedPath))
+            {
+                job.expectedPath = expectedPath;
+            }
+        }
+        std::sort(jobs.begin(), jobs.end(), [](const Job& lhs, const Job& rhs) { return lhs.savePath < rhs.savePath; });
+        return jobs;
+    }
+
+    // Relative paths in a manifest are relative to the manifest itself
+    static std::vector<Job> readManifest(const fs::path& manifestPath)
+    {
+        std::ifstream stream(manifestPath);
+        if (!stream)
+        {
+            throw Exception::RuntimeError("Unable to open manifest");
+        }
+
+        const auto baseDirectory = manifestPath.parent_path();
+        std::vector<Job> jobs;
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            if (!line.empty() && line.back() == '\r')
+            {
+                line.pop_back();
+            }
+            if (line.empty() || line[0] == '#')
+            {
+                continue;
+            }
+
+            Job job;
+            const auto separator = line.find('\t');
+            job.savePath = baseDirectory / fs::u8path(line.substr(0, separator));
+            if (separator != std::string::npos)
+            {
+                job.expectedPath = baseDirectory / fs::u8path(line.substr(separator + 1));
+            }
+            jobs.push_back(job);
+        }
+        return jobs;
+    }
+
+    static Result simulate(const Job& job, int32_t ticks)
+    {
+        const auto timeStarted = ClockType::now();
+
+        Result result{};
+        try
+        {
+            if (!simulateLoadedGame(job.savePath, ticks))
+            {
+                result.status = Status::failed;
+            }
+            else if (!job.expectedPath.empty() && !GameSaveCompare::compareGameStates(job.expectedPath))
+            {
+                result.status = Status::diverged;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to simulate {}: {}", job.savePath.u8string(), e.what());
+            result.status = Status::failed;
+        }
+        catch (...)
+        {
+            Logging::error("Unable to simulate {}", job.savePath.u8string());
+            result.status = Status::failed;
+        }
+
+        const auto& gameState = getGameState();
+        result.scenarioTicks = gameState.scenarioTicks;
+        result.rng = { gameState.rng.srand_0(), gameState.rng.srand_1() };
+        result.durationMs = std::chrono::duration<double, std::milli>(ClockType::now() - timeStarted).count();
+        return result;
+    }
+
+#ifndef _WIN32
+    struct Worker
+    {
+        pid_t pid;
+        int resultFd;
+        size_t job;
+    };
+
+    // Each save is simulated by a child forked from the initialised process so the loaded objects and
+    // graphics are shared, and a save that crashes only takes its own worker down.
+    static std::vector<Result> runJobs(const std::vector<Job>& jobs, int32_t ticks, uint32_t numWorkers)
+    {
+        Result crashedResult{};
+        crashedResult.status = Status::crashed;
+
+        std::vector<Result> results(jobs.size(), crashedResult);
+        std::vector<Worker> workers;
+        size_t nextJob = 0;
+        while (nextJob < jobs.size() || !workers.empty())
+        {
+            while (nextJob < jobs.size() && workers.size() < numWorkers)
+            {
+                const auto job = nextJob++;
+
+                int fds[2];
+                if (pipe(fds) != 0)
+                {
+                    Logging::error("Unable to create a pipe for {}", jobs[job].savePath.u8string());
+                    continue;
+                }
+
+                // Anything still buffered would otherwise be written again by the child
+                std::cout.flush();
+                std::fflush(nullptr);
+
+                const auto pid = fork();
+                if (pid == 0)
+                {
+                    close(fds[0]);
+                    const auto result = simulate(jobs[job], ticks);
+                    [[maybe_unused]] const auto written = write(fds[1], &result, sizeof(result));
+                    std::cout.flush();
+                    std::fflush(nullptr);
+                    _exit(0);
+                }
+
+                close(fds[1]);
+                if (pid < 0)
+                {
+                    Logging::error("Unable to start a worker for {}", jobs[job].savePath.u8string());
+                    close(fds[0]);
+                    continue;
+                }
+                workers.push_back(Worker{ pid, fds[0], job });
+            }
+
+            if (workers.empty())
+            {
+                continue;
+            }
+
+            int exitStatus;
+            const auto pid = waitpid(-1, &exitStatus, 0);
+            if (pid < 0)
+            {
+                Logging::error("Lost track of the batch workers");
+                break;
+            }
+
+            auto worker = std::find_if(workers.begin(), workers.end(), [pid](const Worker& w) { return w.pid == pid; });
+            if (worker == workers.end())
+            {
+                continue;
+            }
+
+            // The result is smaller than the pipe buffer so it is complete once the worker has exited
+            Result result;
+            if (read(worker->resultFd, &result, sizeof(result)) == sizeof(result))
+            {
+                results[worker->job] = result;
+            }
+            close(worker->resultFd);
+            workers.erase(worker);
+        }
+        return results;
+    }
+#else
+    static std::vector<Result> runJobs(const std::vector<Job>& jobs, int32_t ticks, uint32_t)
+    {
+        std::vector<Result> results;
+        results.reserve(jobs.size());
+        for (const auto& job : jobs)
+        {
+            results.push_back(simulate(job, ticks));
+        }
+        return results;
+    }
+#endif
+
+    static void logReport(const Options& options, const std::vector<Job>& jobs, const std::vector<Result>& results, double durationMs)
+    {
+        std::array<uint32_t, kStatusNames.size()> counts{};
+
+        Logging::info("--------------------------------");
+        Logging::info("- Simulate batch");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path:  {}", options.inputPath.u8string());
+        Logging::info("  ticks: {} ticks", options.ticks);
+        Logging::info("Saves:");
+        for (size_t i = 0; i < jobs.size(); i++)
+        {
+            const auto& result = results[i];
+            Logging::info("  {:<9} {:>10.1f} ms  {}", kStatusNames[enumValue(result.status)], result.durationMs, jobs[i].savePath.u8string());
+            counts[enumValue(result.status)]++;
+        }
+        Logging::info("Passed: {} / {}, diverged: {}, failed: {}, crashed: {}", counts[enumValue(Status::passed)], jobs.size(), counts[enumValue(Status::diverged)], counts[enumValue(Status::failed)], counts[enumValue(Status::crashed)]);
+        Logging::info("Duration: {:.3f} sec", durationMs / 1000.0);
+    }
+
+    static void writeReportJson(const Options& options, const std::vector<Job>& jobs, const std::vector<Result>& results, double durationMs)
+    {
+        std::string json = "{\n";
+        json += fmt::format("  \"version\": \"{}\",\n", Benchmark::escapeJsonString(getVersionInfo()));
+        json += fmt::format("  \"path\": \"{}\",\n", Benchmark::escapeJsonString(options.inputPath.u8string()));
+        json += fmt::format("  \"ticks\": {},\n", options.ticks);
+        json += fmt::format("  \"total_ms\": {:.6f},\n", durationMs);
+        json += "  \"saves\": [\n";
+        for (size_t i = 0; i < jobs.size(); i++)
+        {
+            const auto& result = results[i];
+            json += fmt::format("    {{ \"path\": \"{}\", \"expected\": \"{}\", \"status\": \"{}\", \"scenario_ticks\": {}, \"rng\": [{}, {}], \"duration_ms\": {:.6f} }}{}\n",
+                                Benchmark::escapeJsonString(jobs[i].savePath.u8string()),
+                                Benchmark::escapeJsonString(jobs[i].expectedPath.u8string()),
+                                kStatusNames[enumValue(result.status)],
+                                result.scenarioTicks,
+                                result.rng[0],
+                                result.rng[1],
+                                result.durationMs,
+                                i + 1 < jobs.size() ? "," : "");
+        }
+        json += "  ]\n";
+        json += "}\n";
+
+        FileStream stream(options.reportPath, StreamMode::write);
+        stream.write(json.data(), json.size());
+    }
+
+    int run(const Options& options)
+    {
+        std::vector<Job> jobs;
+        try
+        {
+            jobs = fs::is_directory(options.inputPath) ? findJobsInDirectory(options.inputPath) : readManifest(options.inputPath);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to read saves from {}: {}", options.inputPath.u8string(), e.what());
+            return 2;
+        }
+        if (jobs.empty())
+        {
+            Logging::error("No saves found in {}", options.inputPath.u8string());
+            return 2;
+        }
+
+        const auto timeStarted = ClockType::now();
+
+        try
+        {
+            initialiseSimulation();
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to initialise simulation: {}", e.what());
+            return 2;
+        }
+        catch (const GameException)
+        {
+            Logging::error("Unable to initialise simulation!");
+            return 2;
+        }
+
+        auto numWorkers = options.jobs != 0 ? options.jobs : std::thread::hardware_concurrency();
+        numWorkers = std::clamp<uint32_t>(numWorkers, 1, static_cast<uint32_t>(jobs.size()));
+
+        const auto results = runJobs(jobs, options.ticks, numWorkers);
+        const auto durationMs = std::chrono::duration<double, std::milli>(ClockType::now() - timeStarted).count();
+
+        logReport(options, jobs, results, durationMs);
+
+        if (!options.reportPath.empty())
+        {
+            try
+            {
+                writeReportJson(options, jobs, results, durationMs);
+                Logging::info("Report written to {}", options.reportPath.u8string());
+            }
+            catch (...)
+            {
+                Logging::error("Unable to write report to {}", options.reportPath.u8string());
+                return 2;
+            }
+        }
+
+        const auto allPassed = std::all_of(results.begin(), results.end(), [](const Result& result) { return result.status == Status::passed; });
+        return allPassed ? 0 : 1;
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <cstdint>
+
+namespace OpenLoco::SimulateBatch
+{
+    struct Options
+    {
+        // A directory of saves, or a manifest file listing one save per line. A manifest line may give
+        // the expected output after a tab. In a directory the expected output of a save is looked up
+        // in an 'expected' subdirectory under the same file name.
+        fs::path inputPath;
+        int32_t ticks{};
+        uint32_t jobs{}; // Saves simulated at once, 0 uses every hardware thread
+        fs::path reportPath;
+    };
+
+    // Initialises the game once and then simulates every save in a worker process forked from the
+    // initialised state. Platforms without fork simulate each save in turn within this process.
+    // Returns 0 when every save loaded and matched its expected output.
+    int run(const Options& options);
+}
@@ -40,6 +40,7 @@
 #include "Intro.h"
 #include "Logging.h"
 #include "MultiPlayer.h"
+#include "Paint/Paint.h"
 #include "SceneManager.h"
 #include "Tutorial.h"
 #include "Ui.h"
@@ -409,6 +410,12 @@ namespace OpenLoco::Ui
         if (!Intro::isActive())
         {
             drawingEngine.render();
+            Paint::endFrame();
+        }
+        else
+        {
+            // The intro draws straight to the screen
+            drawingEngine.invalidatePresent();
         }
 
         // Draw FPS counter?
@@ -10,10 +10,15 @@
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <fstream>
+#include <future>
 #include <png.h>
 #include <string>
+#include <utility>
+#include <vector>
 
 #pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non-portable
 
@@ -73,69 +78,117 @@ namespace OpenLoco::Ui
         ostream->flush();
     }
 
-    static void saveRenderTargetToPng(Gfx::RenderTarget& rt, std::fstream& outputStream)
+    // Writes a paletted PNG a number of rows at a time so that the image never has to be held in full
+    class PngWriter
     {
-        static loco_global<uint8_t[256][4], 0x0113ED20> _113ED20;
+    private:
+        png_structp _pngPtr = nullptr;
+        png_infop _infoPtr = nullptr;
+        png_colorp _palette = nullptr;
 
-        png_structp pngPtr = nullptr;
-        png_colorp palette = nullptr;
-        try
+    public:
+        PngWriter(std::ostream& outputStream, int32_t width, int32_t height)
         {
-            pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
-            if (pngPtr == nullptr)
-                throw Exception::RuntimeError("png_create_write_struct failed.");
+            static loco_global<uint8_t[256][4], 0x0113ED20> _113ED20;
+
+            try
+            {
+                _pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+                if (_pngPtr == nullptr)
+                    throw Exception::RuntimeError("png_create_write_struct failed.");
+
+                png_set_write_fn(_pngPtr, &outputStream, pngWriteData, pngFlush);
+
+                // Set error handler
+                if (setjmp(png_jmpbuf(_pngPtr)))
+                {
+                    throw Exception::RuntimeError("PNG ERROR");
+                }
 
-            png_set_write_fn(pngPtr, &outputStream, pngWriteData, pngFlush);
+                _infoPtr = png_create_info_struct(_pngPtr);
+                if (_infoPtr == nullptr)
+                    throw Exception::RuntimeError("png_create_info_struct failed.");
 
-            // Set error handler
-            if (setjmp(png_jmpbuf(pngPtr)))
+                _palette = (png_colorp)png_malloc(_pngPtr, 246 * sizeof(png_color));
+                if (_palette == nullptr)
+                    throw Exception::RuntimeError("png_malloc failed.");
+
+                for (size_t i = 0; i < 246; i++)
+                {
+                    _palette[i].blue = _113ED20[i][0];
+                    _palette[i].green = _113ED20[i][1];
+                    _palette[i].red = _113ED20[i][2];
+                }
+                png_set_PLTE(_pngPtr, _infoPtr, _palette, 246);
+
+                png_byte transparentIndex = 0;
+                png_set_tRNS(_pngPtr, _infoPtr, &transparentIndex, 1, nullptr);
+                png_set_IHDR(_pngPtr, _infoPtr, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+                png_write_info(_pngPtr, _infoPtr);
+            }
+            catch (const std::exception&)
             {
-                throw Exception::RuntimeError("PNG ERROR");
+                destroy();
+                throw;
             }
+        }
 
-            auto infoPtr = png_create_info_struct(pngPtr);
-            if (infoPtr == nullptr)
-                throw Exception::RuntimeError("png_create_info_struct failed.");
+        ~PngWriter()
+        {
+            destroy();
+        }
 
-            palette = (png_colorp)png_malloc(pngPtr, 246 * sizeof(png_color));
-            if (palette == nullptr)
-                throw Exception::RuntimeError("png_malloc failed.");
+        PngWriter(const PngWriter&) = delete;
+        PngWriter& operator=(const PngWriter&) = delete;
 
-            for (size_t i = 0; i < 246; i++)
+        // Rows have to be written top to bottom
+        void writeRows(const Gfx::RenderTarget& rt)
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
             {
-                palette[i].blue = _113ED20[i][0];
-                palette[i].green = _113ED20[i][1];
-                palette[i].red = _113ED20[i][2];
+                throw Exception::RuntimeError("PNG ERROR");
             }
-            png_set_PLTE(pngPtr, infoPtr, palette, 246);
-
-            png_byte transparentIndex = 0;
-            png_set_tRNS(pngPtr, infoPtr, &transparentIndex, 1, nullptr);
-            png_set_IHDR(pngPtr, infoPtr, rt.width, rt.height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(pngPtr, infoPtr);
 
-            uint8_t* data = rt.bits;
+            const uint8_t* data = rt.bits;
             for (int y = 0; y < rt.height; y++)
             {
-                png_write_row(pngPtr, data);
+                png_write_row(_pngPtr, data);
                 data += rt.pitch + rt.width;
             }
+        }
+
+        void finish()
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
+            {
+                throw Exception::RuntimeError("PNG ERROR");
+            }
 
-            png_write_end(pngPtr, nullptr);
-            png_destroy_info_struct(pngPtr, &infoPtr);
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
+            png_write_end(_pngPtr, nullptr);
         }
-        catch (const std::exception&)
+
+    private:
+        void destroy()
         {
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
-            throw;
+            if (_pngPtr == nullptr)
+            {
+                return;
+            }
+            png_free(_pngPtr, _palette);
+            _palette = nullptr;
+            png_destroy_write_struct(&_pngPtr, &_infoPtr);
         }
+    };
+
+    static void saveRenderTargetToPng(Gfx::RenderTarget& rt, std::fstream& outputStream)
+    {
+        PngWriter writer(outputStream, rt.width, rt.height);
+        writer.writeRows(rt);
+        writer.finish();
     }
 
     // 0x00452667
-    static std::string prepareSaveScreenshot(Gfx::RenderTarget& rt)
+    static std::pair<fs::path, std::string> getScreenshotPath()
     {
         auto basePath = Platform::getUserDirectory();
         std::string scenarioName = S5::getOptions().scenarioName;
@@ -162,6 +215,13 @@ namespace OpenLoco::Ui
             throw Exception::RuntimeError("Failed finding filename");
         }
 
+        return { path, fileName };
+    }
+
+    static std::string prepareSaveScreenshot(Gfx::RenderTarget& rt)
+    {
+        const auto [path, fileName] = getScreenshotPath();
+
         std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
         saveRenderTargetToPng(rt, outputStream);
 
@@ -198,6 +258,11 @@ namespace OpenLoco::Ui
         return viewport;
     }
 
+    // Rows rendered at a time, bounds the memory used regardless of the zoom level
+    static constexpr int32_t kGiantScreenshotStripHeight = 256;
+
+    // The map is rendered in horizontal strips and each strip is compressed on a worker thread while the
+    // next one renders. Painting itself stays on the main thread as paint sessions use vanilla globals.
     static std::string saveGiantScreenshot()
     {
         const auto& main = WindowManager::getMainWindow();
@@ -211,21 +276,45 @@ namespace OpenLoco::Ui
         // Ensure sprites appear regardless of rotation
         EntityManager::resetSpatialIndex();
 
-        Gfx::RenderTarget rt{};
-        rt.bits = static_cast<uint8_t*>(malloc(resolutionWidth * resolutionHeight));
-        if (rt.bits == nullptr)
-            return nullptr;
-
-        rt.x = 0;
-        rt.y = 0;
-        rt.width = resolutionWidth;
-        rt.height = resolutionHeight;
-        rt.pitch = 0;
-        rt.zoomLevel = 0;
-
-        viewport.render(&rt);
-        auto fileName = prepareSaveScreenshot(rt);
-        free(rt.bits);
+        const auto [path, fileName] = getScreenshotPath();
+        std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
+        PngWriter writer(outputStream, resolutionWidth, resolutionHeight);
+
+        // One strip is rendered while the other is being written
+        std::array<std::vector<uint8_t>, 2> stripBuffers;
+        for (auto& buffer : stripBuffers)
+        {
+            buffer.resize(resolutionWidth * kGiantScreenshotStripHeight);
+        }
+
+        // Declared last so that a pending write finishes before the writer and buffers are destroyed
+        std::future<void> pendingWrite;
+        size_t bufferIndex = 0;
+        for (int32_t stripTop = 0; stripTop < resolutionHeight; stripTop += kGiantScreenshotStripHeight)
+        {
+            Gfx::RenderTarget rt{};
+            rt.bits = stripBuffers[bufferIndex].data();
+            rt.x = 0;
+            rt.y = stripTop;
+            rt.width = resolutionWidth;
+            rt.height = std::min<int32_t>(kGiantScreenshotStripHeight, resolutionHeight - stripTop);
+            rt.pitch = 0;
+            rt.zoomLevel = 0;
+            bufferIndex ^= 1;
+
+            viewport.render(&rt);
+
+            if (pendingWrite.valid())
+            {
+                pendingWrite.get();
+            }
+            pendingWrite = std::async(std::launch::async, [&writer, rt] { writer.writeRows(rt); });
+        }
+        if (pendingWrite.valid())
+        {
+            pendingWrite.get();
+        }
+        writer.finish();
 
         return fileName;
     }
@@ -0,0 +1,69 @@
+#include "LocationOfInterest.h"
+#include <algorithm>
+
+namespace OpenLoco::Vehicles
+{
+    static constexpr size_t kInitialSlots = 64;
+
+    LocationOfInterestHashMap::LocationOfInterestHashMap(size_t maxEntries)
+        : _slots(kInitialSlots)
+        , _maxEntries(maxEntries)
+    {
+    }
+
+    void LocationOfInterestHashMap::clear()
+    {
+        _entries.clear();
+        _generation++;
+        if (_generation == 0)
+        {
+            std::fill(_slots.begin(), _slots.end(), Slot{});
+            _generation = 1;
+        }
+    }
+
+    // Returns the slot holding the interest or the empty slot it would be added to
+    size_t LocationOfInterestHashMap::findSlot(const LocationOfInterest& interest) const
+    {
+        const auto mask = _slots.size() - 1;
+        auto index = LocationOfInterestHash{}(interest) & mask;
+        while (_slots[index].generation == _generation && !(_entries[_slots[index].entry] == interest))
+        {
+            index = (index + 1) & mask;
+        }
+        return index;
+    }
+
+    bool LocationOfInterestHashMap::tryAdd(const LocationOfInterest& interest)
+    {
+        const auto index = findSlot(interest);
+        if (_slots[index].generation == _generation)
+        {
+            return false;
+        }
+        if (isFull())
+        {
+            return false;
+        }
+
+        _slots[index] = Slot{ _generation, static_cast<uint32_t>(_entries.size()) };
+        _entries.push_back(interest);
+
+        // Kept at most half full so probe sequences stay short
+        if (_entries.size() * 2 > _slots.size())
+        {
+            grow();
+        }
+        return true;
+    }
+
+    void LocationOfInterestHashMap::grow()
+    {
+        _slots.assign(_slots.size() * 2, Slot{});
+        _generation = 1;
+        for (size_t i = 0; i < _entries.size(); ++i)
+        {
+            _slots[findSlot(_entries[i])] = Slot{ _generation, static_cast<uint32_t>(i) };
+        }
+    }
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Types.hpp"
+#include "Vehicle.h"
+#include <OpenLoco/Engine/World.hpp>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace OpenLoco::Vehicles
+{
+    struct LocationOfInterest
+    {
+        World::Pos3 loc;
+        uint16_t trackAndDirection; // This is a TaD with a AdditionalTaDFlags::hasSignal bit
+        CompanyId company;
+        uint8_t trackType;
+
+        bool operator==(const LocationOfInterest& rhs) const
+        {
+            return (loc == rhs.loc) && (trackAndDirection == rhs.trackAndDirection) && (company == rhs.company) && (trackType == rhs.trackType);
+        }
+
+        TrackAndDirection::_TrackAndDirection tad() const
+        {
+            return TrackAndDirection::_TrackAndDirection((trackAndDirection & 0x1F8) >> 3, trackAndDirection & 0x7);
+        }
+    };
+
+    struct LocationOfInterestHash
+    {
+        size_t operator()(const LocationOfInterest& interest) const
+        {
+            const uint32_t xy = (static_cast<uint32_t>(static_cast<uint16_t>(interest.loc.x)) << 16) | static_cast<uint16_t>(interest.loc.y);
+            const uint32_t rest = (static_cast<uint32_t>(static_cast<uint16_t>(interest.loc.z)) << 16) ^ interest.trackAndDirection ^ (static_cast<uint32_t>(interest.company) << 8) ^ (static_cast<uint32_t>(interest.trackType) << 24);
+
+            // Murmur3 finaliser so that neighbouring track does not hash to neighbouring slots
+            uint32_t hash = (xy * 0x9E3779B1U) ^ rest;
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6BU;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35U;
+            hash ^= hash >> 16;
+            return hash;
+        }
+    };
+
+    // Set of the track visited by a track network search. Linear probing over slots that only hold an index
+    // into the entries, which are kept in insertion order. The table grows as needed and clearing it keeps
+    // its memory, so one map can be reused by every search.
+    // Note: This is not binary identical to vanilla so cannot be hooked!
+    class LocationOfInterestHashMap
+    {
+    private:
+        struct Slot
+        {
+            uint32_t generation; // Slots from older generations are empty, 0 is never used
+            uint32_t entry;
+        };
+
+        std::vector<Slot> _slots;
+        std::vector<LocationOfInterest> _entries;
+        uint32_t _generation = 1;
+        size_t _maxEntries;
+
+        size_t findSlot(const LocationOfInterest& interest) const;
+        void grow();
+
+    public:
+        explicit LocationOfInterestHashMap(size_t maxEntries = std::numeric_limits<size_t>::max());
+
+        // Removes all entries without releasing memory
+        void clear();
+
+        // Returns false if the interest was already present or the map is full
+        bool tryAdd(const LocationOfInterest& interest);
+
+        size_t count() const { return _entries.size(); }
+        size_t maxEntries() const { return _maxEntries; }
+        bool isFull() const { return _entries.size() >= _maxEntries; }
+
+        auto begin() const { return _entries.begin(); }
+        auto end() const { return _entries.end(); }
+    };
+}
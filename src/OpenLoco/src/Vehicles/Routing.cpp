@@ -2,6 +2,7 @@
 #include "Economy/Economy.h"
 #include "Entities/EntityManager.h"
 #include "GameCommands/GameCommands.h"
+#include "LocationOfInterest.h"
 #include "Map/AnimationManager.h"
 #include "Map/SignalElement.h"
 #include "Map/Tile.h"
@@ -16,6 +17,9 @@
 #include "World/CompanyManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -32,140 +36,40 @@ namespace OpenLoco::Vehicles
     };
     OPENLOCO_ENABLE_ENUM_OPERATORS(TrackNetworkSearchFlags);
 
-    struct LocationOfInterest
+    // Connections found by getTrackConnections along with the globals it leaves behind
+    struct CachedTrackConnections
     {
-        World::Pos3 loc;
-        uint16_t trackAndDirection; // This is a TaD with a AdditionalTaDFlags::hasSignal bit
-        CompanyId company;
-        uint8_t trackType;
-
-        bool operator==(const LocationOfInterest& rhs) const
-        {
-            return (loc == rhs.loc) && (trackAndDirection == rhs.trackAndDirection) && (company == rhs.company) && (trackType == rhs.trackType);
-        }
-
-        TrackAndDirection::_TrackAndDirection tad() const
-        {
-            return TrackAndDirection::_TrackAndDirection((trackAndDirection & 0x1F8) >> 3, trackAndDirection & 0x7);
-        }
+        World::Track::TrackConnections connections;
+        StationId station;
+        uint8_t levelCrossing;
     };
 
-    // Note: This is not binary identical to vanilla so cannot be hooked!
-    struct LocationOfInterestHashMap
+    // Neighbours of a piece of track found by the track network search, each searched for on first use
+    struct TrackNetworkNode
     {
-        static constexpr auto kMinFreeSlots = 100; // There must always be at least 100 free slots otherwise the hashmap gets very inefficient
-
-    private:
-        class Iterator
-        {
-            uint16_t _index;
-            const LocationOfInterestHashMap& _map;
-
-        public:
-            Iterator(uint16_t index, const LocationOfInterestHashMap& map)
-                : _index(index)
-                , _map(map)
-            {
-                findAllocatedEntry();
-            }
-
-            void findAllocatedEntry()
-            {
-                while (_index < _map.mapSize && _map.locs[_index].loc == World::Pos3{ -1, -1, 0 })
-                {
-                    _index++;
-                }
-            }
-
-            Iterator& operator++()
-            {
-                _index++;
-                findAllocatedEntry();
-                return *this;
-            }
-
-            Iterator operator++(int)
-            {
-                Iterator retval = *this;
-                ++(*this);
-                return retval;
-            }
-
-            bool operator==(const Iterator& other) const
-            {
-                return _index == other._index;
-            }
-
-            LocationOfInterest operator*() const
-            {
-                return _map.get(_index);
-            }
-            // iterator traits
-            using difference_type = std::ptrdiff_t;
-            using value_type = LocationOfInterest;
-            using pointer = LocationOfInterest*;
-            using reference = LocationOfInterest&;
-            using iterator_category = std::forward_iterator_tag;
-        };
-
-    public:
-        std::vector<LocationOfInterest> locs;
-        size_t count;
-        uint16_t mapSize;
-        uint16_t mapSizeMask;
-        uint16_t maxEntries;
-
-        LocationOfInterestHashMap(uint16_t _maxSize)
-            : count()
-            , mapSize(_maxSize)
-            , mapSizeMask(_maxSize - 1)
-            , maxEntries(_maxSize - kMinFreeSlots)
-        {
-            assert((mapSize & (mapSizeMask)) == 0); // Only works with powers of 2
-            locs.resize(mapSize);
-            std::fill(std::begin(locs), std::end(locs), LocationOfInterest{ World::Pos3{ -1, -1, 0 }, 0, CompanyId::null, 0 });
-        }
-
-        LocationOfInterest get(const uint16_t index) const
-        {
-            return locs[index];
-        }
-
-        constexpr uint16_t hash(const LocationOfInterest& interest) const
-        {
-            return ((((interest.loc.x ^ interest.loc.z) / 32) ^ interest.loc.y) ^ interest.trackAndDirection) & mapSizeMask;
-        }
-
-        // 0x004A38DE & 0x004A3972
-        bool tryAdd(LocationOfInterest& interest)
-        {
-            auto index = hash(interest);
-            for (; locs[index].loc != World::Pos3{ -1, -1, 0 }; ++index, index &= mapSizeMask)
-            {
-                if (get(index) == interest)
-                {
-                    return false;
-                }
-            }
-            if (count >= maxEntries)
-            {
-                return false;
-            }
-            locs[index] = interest;
-            count++;
-            return true;
-        }
+        std::optional<CachedTrackConnections> endConnections;
+        std::optional<CachedTrackConnections> startConnections;
+        std::optional<std::vector<LocationOfInterest>> overlappingTrack;
+    };
 
-        Iterator begin() const
-        {
-            return Iterator(0, *this);
-        }
-        Iterator end() const
-        {
-            return Iterator(mapSize, *this);
-        }
+    // Result of searching the track network from a piece of track until reaching signals
+    struct SignalBlock
+    {
+        std::vector<LocationOfInterest> visited; // Track passed to the filter, in search order
+        std::vector<LocationOfInterest> members; // Contents of the search hash map, in iteration order
+        StationId station;
+        uint8_t levelCrossing;
+        bool hasDeadEnd;
     };
 
+    // Track connectivity is kept between searches as finding the neighbours of a piece of track walks the
+    // tile elements at both of its ends and of every tile it covers. Track only changes while a game command
+    // is applied or when a map is loaded, so the cache is cleared then and is not used while a command runs.
+    static constexpr size_t kMaxTrackNetworkNodes = 0x10000;
+    static constexpr size_t kMaxSignalBlocks = 0x2000;
+    static std::unordered_map<LocationOfInterest, TrackNetworkNode, LocationOfInterestHash> _trackNetworkNodes;
+    static std::unordered_map<LocationOfInterest, SignalBlock, LocationOfInterestHash> _signalBlocks;
+
     // using FilterFunction = bool (*)(const LocationOfInterest& interest);          // TODO C++20 make these concepts
     // using TransformFunction = void (*)(const LocationOfInterestHashMap& hashMap); // TODO C++20 make these concepts
 
@@ -180,6 +84,46 @@ namespace OpenLoco::Vehicles
     static loco_global<TrackNetworkSearchFlags, 0x01135FA6> _findTrackNetworkFlags;
     static loco_global<uint8_t, 0x01136085> _1136085;
     static loco_global<uint8_t[2], 0x0113601A> _113601A; // Track Connection mod global
+    static loco_global<StationId, 0x01135FAE> _1135FAE;  // Set by getTrackConnections
+    static loco_global<uint8_t, 0x0113607D> _113607D;    // Set by getTrackConnections
+
+    void invalidateTrackNetworkCache()
+    {
+        _trackNetworkNodes.clear();
+        _signalBlocks.clear();
+    }
+
+    static bool isTrackNetworkCacheUsable()
+    {
+        return GameCommands::getCommandNestLevel() == 0;
+    }
+
+    // Returns nullptr when the cache can not be used
+    static TrackNetworkNode* getTrackNetworkNode(const LocationOfInterest& interest)
+    {
+        if (!isTrackNetworkCacheUsable())
+        {
+            return nullptr;
+        }
+        return &_trackNetworkNodes[interest];
+    }
+
+    static void getTrackConnections(std::optional<CachedTrackConnections>* cached, const World::Pos3& loc, const uint8_t rotation, World::Track::TrackConnections& connections, const CompanyId company, const uint8_t trackType)
+    {
+        if (cached != nullptr && cached->has_value())
+        {
+            connections = (*cached)->connections;
+            _1135FAE = (*cached)->station;
+            _113607D = (*cached)->levelCrossing;
+            return;
+        }
+
+        World::Track::getTrackConnections(loc, rotation, connections, company, trackType);
+        if (cached != nullptr)
+        {
+            *cached = CachedTrackConnections{ connections, _1135FAE, _113607D };
+        }
+    }
 
     static std::optional<std::pair<World::SignalElement*, World::TrackElement*>> findSignalOnTrack(const World::Pos3& signalLoc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, const uint8_t index)
     {
@@ -458,9 +402,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A2CE7
-    static void setSignalsOccupiedState(const LocationOfInterestHashMap& hashMap, const uint16_t& routingTransformData)
+    static void setSignalsOccupiedState(const std::vector<LocationOfInterest>& signalBlock, const uint16_t& routingTransformData)
     {
-        for (const auto& interest : hashMap)
+        for (const auto& interest : signalBlock)
         {
             if (!(interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal))
             {
@@ -495,15 +439,10 @@ namespace OpenLoco::Vehicles
     template<typename FilterFunction>
     static void findAllUsableTrackInNetwork(std::vector<LocationOfInterest>& additionalTrackToCheck, const LocationOfInterest& initialInterest, FilterFunction&& filterFunction, LocationOfInterestHashMap& hashMap);
 
-    // 0x004A313B & 0x004A35B7
-    // Iterates all individual tiles of a track piece to find tracks that need inspection
-    template<typename FilterFunction>
-    static void findAllUsableTrackPieces(std::vector<LocationOfInterest>& additionalTrackToCheck, const LocationOfInterest& interest, FilterFunction&& filterFunction, LocationOfInterestHashMap& hashMap)
+    // Finds the track of other pieces sharing the tiles of a track piece, in both directions
+    static std::vector<LocationOfInterest> findOverlappingTrack(const LocationOfInterest& interest)
     {
-        if ((_findTrackNetworkFlags & TrackNetworkSearchFlags::unk2) == TrackNetworkSearchFlags::none)
-        {
-            return;
-        }
+        std::vector<LocationOfInterest> overlappingTrack;
 
         const auto tad = interest.tad();
         auto nextLoc = interest.loc;
@@ -559,16 +498,7 @@ namespace OpenLoco::Vehicles
                 const auto startTargetPos2 = World::Pos2{ pieceLoc } - Math::Vector::rotate(World::Pos2{ targetPiece.x, targetPiece.y }, elTrack->unkDirection());
                 const auto startTargetPos = World::Pos3{ startTargetPos2, static_cast<int16_t>(elTrack->baseHeight() - targetPiece.z) };
                 TrackAndDirection::_TrackAndDirection tad2(elTrack->trackId(), elTrack->unkDirection());
-                LocationOfInterest newInterest{ startTargetPos, tad2._data, elTrack->owner(), elTrack->trackObjectId() };
-
-                if (hashMap.tryAdd(newInterest))
-                {
-                    if (!filterFunction(newInterest))
-                    {
-                        findAllUsableTrackPieces(additionalTrackToCheck, newInterest, filterFunction, hashMap);
-                        additionalTrackToCheck.push_back(newInterest);
-                    }
-                }
+                overlappingTrack.push_back(LocationOfInterest{ startTargetPos, tad2._data, elTrack->owner(), elTrack->trackObjectId() });
 
                 auto& trackSize = World::TrackData::getUnkTrack(tad2._data);
                 auto endTargetPos = startTargetPos + trackSize.pos;
@@ -578,15 +508,45 @@ namespace OpenLoco::Vehicles
                 }
 
                 tad2.setReversed(!tad2.isReversed());
-                LocationOfInterest newInterestR{ endTargetPos, tad2._data, elTrack->owner(), elTrack->trackObjectId() };
+                overlappingTrack.push_back(LocationOfInterest{ endTargetPos, tad2._data, elTrack->owner(), elTrack->trackObjectId() });
+            }
+        }
+        return overlappingTrack;
+    }
 
-                if (hashMap.tryAdd(newInterestR))
+    // 0x004A313B & 0x004A35B7
+    // Iterates all individual tiles of a track piece to find tracks that need inspection
+    template<typename FilterFunction>
+    static void findAllUsableTrackPieces(std::vector<LocationOfInterest>& additionalTrackToCheck, const LocationOfInterest& interest, FilterFunction&& filterFunction, LocationOfInterestHashMap& hashMap)
+    {
+        if ((_findTrackNetworkFlags & TrackNetworkSearchFlags::unk2) == TrackNetworkSearchFlags::none)
+        {
+            return;
+        }
+
+        std::vector<LocationOfInterest> uncachedOverlappingTrack;
+        const std::vector<LocationOfInterest>* overlappingTrack = &uncachedOverlappingTrack;
+        if (auto* node = getTrackNetworkNode(interest); node != nullptr)
+        {
+            if (!node->overlappingTrack)
+            {
+                node->overlappingTrack = findOverlappingTrack(interest);
+            }
+            overlappingTrack = &*node->overlappingTrack;
+        }
+        else
+        {
+            uncachedOverlappingTrack = findOverlappingTrack(interest);
+        }
+
+        for (auto newInterest : *overlappingTrack)
+        {
+            if (hashMap.tryAdd(newInterest))
+            {
+                if (!filterFunction(newInterest))
                 {
-                    if (!filterFunction(newInterestR))
-                    {
-                        findAllUsableTrackPieces(additionalTrackToCheck, newInterestR, filterFunction, hashMap);
-                        additionalTrackToCheck.push_back(newInterestR);
-                    }
+                    findAllUsableTrackPieces(additionalTrackToCheck, newInterest, filterFunction, hashMap);
+                    additionalTrackToCheck.push_back(newInterest);
                 }
             }
         }
@@ -601,8 +561,9 @@ namespace OpenLoco::Vehicles
         _113601A[1] = 0;
         connections.size = 0;
 
+        auto* node = getTrackNetworkNode(initialInterest);
         const auto [trackEndLoc, trackEndRotation] = World::Track::getTrackConnectionEnd(initialInterest.loc, initialInterest.tad()._data);
-        World::Track::getTrackConnections(trackEndLoc, trackEndRotation, connections, initialInterest.company, initialInterest.trackType);
+        getTrackConnections(node != nullptr ? &node->endConnections : nullptr, trackEndLoc, trackEndRotation, connections, initialInterest.company, initialInterest.trackType);
 
         if (connections.size != 0)
         {
@@ -638,7 +599,7 @@ namespace OpenLoco::Vehicles
 
             connections.size = 0;
             const auto rotation = World::kReverseRotation[trackSize.rotationEnd];
-            World::Track::getTrackConnections(nextLoc, rotation, connections, initialInterest.company, initialInterest.trackType);
+            getTrackConnections(node != nullptr ? &node->startConnections : nullptr, nextLoc, rotation, connections, initialInterest.company, initialInterest.trackType);
             for (size_t i = 0; i < connections.size; ++i)
             {
                 uint16_t trackAndDirection2 = connections.data[i] & World::Track::AdditionalTaDFlags::basicTaDWithSignalMask;
@@ -655,8 +616,14 @@ namespace OpenLoco::Vehicles
         }
     }
 
-    constexpr size_t kSignalHashMapSize = 0x400;
-    constexpr size_t kTrackModHashMapSize = 0x1000;
+    // Vanilla used fixed size hash maps of 0x400 and 0x1000 slots that always kept 100 slots free. The
+    // searches still stop at those limits as the network found by them affects the game.
+    constexpr size_t kMaxSignalSearchEntries = 0x400 - 100;
+    constexpr size_t kMaxTrackModSearchEntries = 0x1000 - 100;
+
+    // Reused by every search so they do not allocate once grown
+    static LocationOfInterestHashMap _signalSearchMap{ kMaxSignalSearchEntries };
+    static LocationOfInterestHashMap _trackModSearchMap{ kMaxTrackModSearchEntries };
 
     // 0x004A2E46 & 0x004A2DE4
     template<typename FilterFunction, typename TransformFunction>
@@ -669,6 +636,11 @@ namespace OpenLoco::Vehicles
 
         _findTrackNetworkFlags = searchFlags;
 
+        if (_trackNetworkNodes.size() >= kMaxTrackNetworkNodes)
+        {
+            _trackNetworkNodes.clear();
+        }
+
         // Note: This function and its call chain findAllUsableTrackInNetwork and findAllUsableTrackPieces have been modified
         // to not be recursive anymore.
         std::vector<LocationOfInterest> trackToCheck{ LocationOfInterest{ loc, trackAndDirection._data, company, trackType } };
@@ -681,43 +653,106 @@ namespace OpenLoco::Vehicles
         transformFunction(interestMap);
     }
 
-    // 0x004A2AD7
-    void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    static SignalBlock findSignalBlock(const LocationOfInterest& start)
     {
-        // 0x001135F88
-        uint16_t routingTransformData = 0;
+        SignalBlock block{};
 
-        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData); };
-        auto transformFunction = [&routingTransformData](const LocationOfInterestHashMap& interestMap) { setSignalsOccupiedState(interestMap, routingTransformData); };
-        LocationOfInterestHashMap interestMap{ kSignalHashMapSize };
+        // Both signal searches stop at and only at signals so the track they visit does not depend on their filter
+        auto filterFunction = [&block](const LocationOfInterest& interest) {
+            block.visited.push_back(interest);
+            return (interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal) != 0;
+        };
+        auto transformFunction = [&block](const LocationOfInterestHashMap& interestMap) {
+            for (const auto& interest : interestMap)
+            {
+                block.members.push_back(interest);
+            }
+        };
+        auto& interestMap = _signalSearchMap;
+        interestMap.clear();
 
+        const auto previousFlags = *_1136085;
+        _1136085 = previousFlags & ~(1 << 0);
         findAllTracksFilterTransform(
             interestMap,
             TrackNetworkSearchFlags::unk0 | TrackNetworkSearchFlags::unk2,
-            loc,
-            trackAndDirection,
-            company,
-            trackType,
+            start.loc,
+            start.tad(),
+            start.company,
+            start.trackType,
             filterFunction,
             transformFunction);
+        block.hasDeadEnd = (_1136085 & (1 << 0)) != 0;
+        _1136085 = *_1136085 | previousFlags;
+
+        block.station = _1135FAE;
+        block.levelCrossing = _113607D;
+        return block;
+    }
+
+    // Equivalent to findAllTracksFilterTransform with a filter that stops at signals, the block is only searched
+    // for when it is not cached. Leaves the search globals as the search would have.
+    template<typename FilterFunction, typename TransformFunction>
+    static void findSignalBlockFilterTransform(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType, FilterFunction&& filterFunction, TransformFunction&& transformFunction)
+    {
+        const LocationOfInterest start{ loc, trackAndDirection._data, company, trackType };
+
+        SignalBlock uncachedBlock;
+        const SignalBlock* block = &uncachedBlock;
+        if (isTrackNetworkCacheUsable())
+        {
+            if (_signalBlocks.size() >= kMaxSignalBlocks)
+            {
+                _signalBlocks.clear();
+            }
+            auto [it, inserted] = _signalBlocks.try_emplace(start);
+            if (inserted)
+            {
+                it->second = findSignalBlock(start);
+            }
+            block = &it->second;
+        }
+        else
+        {
+            uncachedBlock = findSignalBlock(start);
+        }
+
+        _findTrackNetworkFlags = TrackNetworkSearchFlags::unk0 | TrackNetworkSearchFlags::unk2;
+        _113601A[0] = 0;
+        _113601A[1] = 0;
+        _1135FAE = block->station;
+        _113607D = block->levelCrossing;
+        if (block->hasDeadEnd)
+        {
+            _1136085 = *_1136085 | (1 << 0);
+        }
+
+        for (const auto& interest : block->visited)
+        {
+            filterFunction(interest);
+        }
+        transformFunction(block->members);
+    }
+
+    // 0x004A2AD7
+    void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    {
+        // 0x001135F88
+        uint16_t routingTransformData = 0;
+
+        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData); };
+        auto transformFunction = [&routingTransformData](const std::vector<LocationOfInterest>& signalBlock) { setSignalsOccupiedState(signalBlock, routingTransformData); };
+
+        findSignalBlockFilterTransform(loc, trackAndDirection, company, trackType, filterFunction, transformFunction);
     }
 
     uint8_t sub_4A2A58(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
     {
         // 0x001135F88
         uint16_t unk = 0;
-        LocationOfInterestHashMap interestMap{ kSignalHashMapSize };
         auto filterFunction = [&unk](const LocationOfInterest& interest) { return sub_4A2D4C(interest, unk); };
 
-        findAllTracksFilterTransform(
-            interestMap,
-            TrackNetworkSearchFlags::unk0 | TrackNetworkSearchFlags::unk2,
-            loc,
-            trackAndDirection,
-            company,
-            trackType,
-            filterFunction,
-            kNullTransformFunction);
+        findSignalBlockFilterTransform(loc, trackAndDirection, company, trackType, filterFunction, [](const std::vector<LocationOfInterest>&) {});
 
         return unk;
     }
@@ -1035,13 +1070,14 @@ namespace OpenLoco::Vehicles
             return result;
         }
 
-        LocationOfInterestHashMap interestHashMap{ kTrackModHashMapSize };
+        auto& interestHashMap = _trackModSearchMap;
+        interestHashMap.clear();
 
         auto filterFunction = [flags, modSelection, trackType, trackModObjIds, &result, company, &interestHashMap](const LocationOfInterest& interest) {
             return applyTrackModToTrack(interest, flags, &interestHashMap, modSelection, trackType, trackModObjIds, result.cost, company, result.allPlacementsFailed);
         };
         findAllTracksFilterTransform(interestHashMap, TrackNetworkSearchFlags::unk0, pos, trackAndDirection, company, trackType, filterFunction, kNullTransformFunction);
-        result.networkTooComplex = interestHashMap.count >= interestHashMap.maxEntries;
+        result.networkTooComplex = interestHashMap.isFull();
         return result;
     }
 
@@ -1055,7 +1091,8 @@ namespace OpenLoco::Vehicles
             return cost;
         }
 
-        LocationOfInterestHashMap interestHashMap{ kTrackModHashMapSize };
+        auto& interestHashMap = _trackModSearchMap;
+        interestHashMap.clear();
 
         auto filterFunction = [flags, modSelection, trackType, trackModObjIds, &cost, company, &interestHashMap](const LocationOfInterest& interest) {
             return removeTrackModToTrack(interest, flags, &interestHashMap, modSelection, trackType, trackModObjIds, cost, company);
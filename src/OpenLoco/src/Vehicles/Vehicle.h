@@ -185,6 +185,8 @@ namespace OpenLoco::Vehicles
     uint8_t getSignalState(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, uint32_t flags);
     void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
     uint8_t sub_4A2A58(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
+    // Clears the track connectivity cached by the track network searches, call whenever track may have changed
+    void invalidateTrackNetworkCache();
     struct ApplyTrackModsResult
     {
         currency32_t cost;
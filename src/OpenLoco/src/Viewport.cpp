@@ -20,7 +20,9 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Core/JobPool.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <array>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
@@ -239,6 +241,114 @@ namespace OpenLoco::Ui
         }
     }
 
+    // Drawing is performed in columns of 32 pixels (1 tile wide)
+    static Gfx::RenderTarget getColumnRenderTarget(const Gfx::RenderTarget& zoomViewRt, const int32_t columnX)
+    {
+        Gfx::RenderTarget columnRt = zoomViewRt;
+        if (columnX >= columnRt.x)
+        {
+            auto leftPitch = columnX - columnRt.x;
+            columnRt.width -= leftPitch;
+            columnRt.pitch += (leftPitch >> columnRt.zoomLevel);
+            columnRt.bits += (leftPitch >> columnRt.zoomLevel);
+            columnRt.x = columnX;
+        }
+        auto columnRightX = columnX + 32;
+        auto paintRight = columnRt.x + columnRt.width;
+        if (paintRight >= columnRightX)
+        {
+            auto rightPitch = paintRight - columnX - 32;
+            paintRight -= rightPitch;
+            columnRt.pitch += rightPitch >> columnRt.zoomLevel;
+        }
+
+        columnRt.width = paintRight - columnRt.x;
+        return columnRt;
+    }
+
+    static void drawColumnLabels(Gfx::RenderTarget& columnRt, const Paint::SessionOptions& options)
+    {
+        // Climate code used to draw here.
+
+        if (!isTitleMode())
+        {
+            if (!options.hasFlags(ViewportFlags::station_names_displayed))
+            {
+                if (columnRt.zoomLevel <= Config::get().old.stationNamesMinScale)
+                {
+                    drawStationNames(columnRt);
+                }
+            }
+            if (!options.hasFlags(ViewportFlags::town_names_displayed))
+            {
+                drawTownNames(columnRt);
+            }
+        }
+    }
+
+    static constexpr int32_t kColumnsPerBatch = 16;
+
+    static Core::JobPool& getPaintJobPool()
+    {
+        static Core::JobPool pool;
+        return pool;
+    }
+
+    // Each column in a batch has its own paint entries so that the arranged structs remain valid until drawn
+    static Paint::PaintEntryArena& getColumnPaintEntryArena(const size_t column)
+    {
+        static std::array<Paint::PaintEntryArena, kColumnsPerBatch> arenas;
+        return arenas[column];
+    }
+
+    // Output is identical to the serial path. Only clearing and drawing the columns is done in parallel.
+    // Generating and arranging stay on the main thread with the single quadrant table, as surfaces,
+    // roads and road stations are still painted by vanilla routines that read and write the fixed
+    // session globals. Masked images are still drawn by the vanilla routine, one worker at a time.
+    // Labels are drawn last on the main thread as text drawing uses global font state.
+    static void paintColumnsParallel(const Gfx::RenderTarget& zoomViewRt, const Paint::SessionOptions& options, const PaletteIndex_t fillColour)
+    {
+        auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
+        auto& jobPool = getPaintJobPool();
+
+        const auto rightBorder = zoomViewRt.x + zoomViewRt.width;
+        const auto alignedX = zoomViewRt.x & ~0x1F;
+
+        std::array<Gfx::RenderTarget, kColumnsPerBatch> columnRts{};
+        std::array<Paint::ArrangedSession, kColumnsPerBatch> arrangedSessions{};
+
+        for (auto batchX = alignedX; batchX < rightBorder; batchX += 32 * kColumnsPerBatch)
+        {
+            int32_t numColumns = 0;
+            for (auto columnX = batchX; columnX < rightBorder && numColumns < kColumnsPerBatch; columnX += 32, numColumns++)
+            {
+                auto& columnRt = columnRts[numColumns];
+                columnRt = getColumnRenderTarget(zoomViewRt, columnX);
+
+                auto* sess = Paint::allocateSession(columnRt, options, getColumnPaintEntryArena(numColumns));
+                sess->generate();
+                sess->arrangeStructs();
+                arrangedSessions[numColumns] = sess->getArrangedSession();
+            }
+
+            for (auto i = 0; i < numColumns; i++)
+            {
+                jobPool.addTask([&drawingCtx, &columnRt = columnRts[i], &arranged = arrangedSessions[i], fillColour] {
+                    drawingCtx.clearSingle(columnRt, fillColour);
+                    Paint::PaintSession::drawStructs(arranged);
+                });
+            }
+            jobPool.join();
+
+            for (auto i = 0; i < numColumns; i++)
+            {
+                drawColumnLabels(columnRts[i], options);
+                Paint::PaintSession::drawStringStructs(arrangedSessions[i]);
+                drawRoutingNumbers(columnRts[i]);
+            }
+        }
+    }
+
     // 0x0045A1A4
     void Viewport::paint(Gfx::RenderTarget* rt, const Rect& rect)
     {
@@ -278,6 +388,12 @@ namespace OpenLoco::Ui
         zoomViewRt.bits = rt->bits + (unkX - rt->x) + ((unkY - rt->y) * (rt->width + rt->pitch));
         zoomViewRt.zoomLevel = zoom;
 
+        if (Config::get().multiThreadedRendering)
+        {
+            paintColumnsParallel(zoomViewRt, options, fillColour);
+            return;
+        }
+
         auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
 
         // make sure, the compare operation is done in int32_t to avoid the loop becoming an infinite loop.
@@ -286,52 +402,17 @@ namespace OpenLoco::Ui
         // Floors to nearest 32
         auto alignedX = zoomViewRt.x & ~0x1F;
 
-        // Drawing is performed in columns of 32 pixels (1 tile wide)
-
         // Generate and sort columns.
         for (auto columnX = alignedX; columnX < rightBorder; columnX += 32)
         {
-            Gfx::RenderTarget columnRt = zoomViewRt;
-            if (columnX >= columnRt.x)
-            {
-                auto leftPitch = columnX - columnRt.x;
-                columnRt.width -= leftPitch;
-                columnRt.pitch += (leftPitch >> columnRt.zoomLevel);
-                columnRt.bits += (leftPitch >> columnRt.zoomLevel);
-                columnRt.x = columnX;
-            }
-            auto columnRightX = columnX + 32;
-            auto paintRight = columnRt.x + columnRt.width;
-            if (paintRight >= columnRightX)
-            {
-                auto rightPitch = paintRight - columnX - 32;
-                paintRight -= rightPitch;
-                columnRt.pitch += rightPitch >> columnRt.zoomLevel;
-            }
-
-            columnRt.width = paintRight - columnRt.x;
+            Gfx::RenderTarget columnRt = getColumnRenderTarget(zoomViewRt, columnX);
 
             drawingCtx.clearSingle(columnRt, fillColour);
             auto* sess = Paint::allocateSession(columnRt, options);
             sess->generate();
             sess->arrangeStructs();
             sess->drawStructs();
-            // Climate code used to draw here.
-
-            if (!isTitleMode())
-            {
-                if (!options.hasFlags(ViewportFlags::station_names_displayed))
-                {
-                    if (columnRt.zoomLevel <= Config::get().old.stationNamesMinScale)
-                    {
-                        drawStationNames(columnRt);
-                    }
-                }
-                if (!options.hasFlags(ViewportFlags::town_names_displayed))
-                {
-                    drawTownNames(columnRt);
-                }
-            }
+            drawColumnLabels(columnRt, options);
 
             sess->drawStringStructs();
             drawRoutingNumbers(columnRt);
@@ -2,6 +2,7 @@
 #include "Config.h"
 #include "Drawing/SoftwareDrawingEngine.h"
 #include "Entities/EntityManager.h"
+#include "Entities/EntityTweener.h"
 #include "Graphics/Colour.h"
 #include "Input.h"
 #include "Localisation/FormatArguments.hpp"
@@ -288,13 +289,14 @@ namespace OpenLoco::Ui
             if (config->viewportTargetSprite != EntityId::null)
             {
                 auto entity = EntityManager::get<EntityBase>(config->viewportTargetSprite);
+                const auto renderPos = EntityTweener::get().getRenderPosition(*entity);
 
-                int z = (TileManager::getHeight(entity->position).landHeight) - 16;
-                bool underground = (entity->position.z < z);
+                int z = (TileManager::getHeight(renderPos).landHeight) - 16;
+                bool underground = (renderPos.z < z);
 
                 viewportSetUndergroundFlag(underground, viewport);
 
-                centre = viewport->centre2dCoordinates(entity->position + Pos3{ 0, 0, 12 });
+                centre = viewport->centre2dCoordinates(renderPos + Pos3{ 0, 0, 12 });
             }
             else
             {
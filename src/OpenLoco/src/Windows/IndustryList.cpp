@@ -29,6 +29,11 @@
 #include "World/IndustryManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Utility/Collection.hpp>
+#include <algorithm>
+#include <bitset>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -105,6 +110,9 @@ namespace OpenLoco::Ui::Windows::IndustryList
             ProductionTransported,
         };
 
+        // Formatted keys are only rebuilt for this many rows per tick
+        static constexpr size_t kSortKeysPerTick = 16;
+
         // 0x00457B94
         static void prepareDraw(Window& self)
         {
@@ -216,36 +224,6 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.invalidate();
         }
 
-        // 0x00457A52
-        static bool orderByName(const OpenLoco::Industry& lhs, const OpenLoco::Industry& rhs)
-        {
-            char lhsString[256] = { 0 };
-            StringManager::formatString(lhsString, lhs.name, (void*)&lhs.town);
-
-            char rhsString[256] = { 0 };
-            StringManager::formatString(rhsString, rhs.name, (void*)&rhs.town);
-
-            return strcmp(lhsString, rhsString) < 0;
-        }
-
-        // 0x00457A9F
-        static bool orderByStatus(OpenLoco::Industry& lhs, OpenLoco::Industry& rhs)
-        {
-            char lhsString[256] = { 0 };
-            const char* lhsBuffer = StringManager::getString(StringIds::buffer_1250);
-            lhs.getStatusString((char*)lhsBuffer);
-
-            StringManager::formatString(lhsString, StringIds::buffer_1250);
-
-            char rhsString[256] = { 0 };
-            const char* rhsBuffer = StringManager::getString(StringIds::buffer_1250);
-            rhs.getStatusString((char*)rhsBuffer);
-
-            StringManager::formatString(rhsString, StringIds::buffer_1250);
-
-            return strcmp(lhsString, rhsString) < 0;
-        }
-
         static uint8_t getAverageTransportedCargo(const OpenLoco::Industry& industry)
         {
             auto industryObj = ObjectManager::get<IndustryObject>(industry.objectId);
@@ -267,90 +245,119 @@ namespace OpenLoco::Ui::Windows::IndustryList
             return productionTransported;
         }
 
-        // 0x00457AF3
-        static bool orderByProductionTransported(const OpenLoco::Industry& lhs, const OpenLoco::Industry& rhs)
+        // Keys are built once per industry rather than on every comparison
+        struct SortEntry
         {
-            auto lhsVar = getAverageTransportedCargo(lhs);
-
-            auto rhsVar = getAverageTransportedCargo(rhs);
+            IndustryId id;
+            std::string name;
+            uint8_t value;
+        };
 
-            return rhsVar < lhsVar;
-        }
+        // Rows of the list, kept sorted across ticks
+        static std::vector<SortEntry> _sortEntries;
 
         // 0x00457A52, 0x00457A9F, 0x00457AF3
-        static bool getOrder(const SortMode mode, OpenLoco::Industry& lhs, OpenLoco::Industry& rhs)
+        static SortEntry getSortEntry(const SortMode mode, OpenLoco::Industry& industry)
         {
+            SortEntry entry{ industry.id(), {}, 0 };
             switch (mode)
             {
                 case SortMode::Name:
-                    return orderByName(lhs, rhs);
+                {
+                    char buffer[256] = { 0 };
+                    StringManager::formatString(buffer, industry.name, (void*)&industry.town);
+                    entry.name = buffer;
+                    break;
+                }
+
+                case SortMode::Status:
+                {
+                    char buffer[256] = { 0 };
+                    const char* statusBuffer = StringManager::getString(StringIds::buffer_1250);
+                    industry.getStatusString((char*)statusBuffer);
 
+                    StringManager::formatString(buffer, StringIds::buffer_1250);
+                    entry.name = buffer;
+                    break;
+                }
+
+                case SortMode::ProductionTransported:
+                    entry.value = getAverageTransportedCargo(industry);
+                    break;
+            }
+            return entry;
+        }
+
+        static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
+        {
+            switch (mode)
+            {
+                case SortMode::Name:
                 case SortMode::Status:
-                    return orderByStatus(lhs, rhs);
+                    return strcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
 
                 case SortMode::ProductionTransported:
-                    return orderByProductionTransported(lhs, rhs);
+                    return rhs.value < lhs.value;
             }
 
             return false;
         }
 
         // 0x00457991
+        // Called every tick. The rows are kept from the last tick, so refreshing the keys and an insertion sort
+        // is enough to move the few rows whose values changed into place.
         static void updateIndustryList(Window* self)
         {
-            auto chosenIndustry = IndustryId::null;
-
-            for (auto& industry : IndustryManager::industries())
-            {
-                if (industry.hasFlags(IndustryFlags::sorted))
-                    continue;
+            const auto mode = SortMode(self->sortMode);
+            auto& entries = _sortEntries;
 
-                if (chosenIndustry == IndustryId::null)
+            // Drop removed industries, new ones are added at the end and sorted into place
+            std::bitset<Limits::kMaxIndustries> isListed;
+            std::erase_if(entries, [&isListed](const SortEntry& entry) {
+                if (IndustryManager::get(entry.id)->empty())
                 {
-                    chosenIndustry = industry.id();
-                    continue;
+                    return true;
                 }
-
-                if (getOrder(SortMode(self->sortMode), industry, *IndustryManager::get(chosenIndustry)))
+                isListed.set(enumValue(entry.id));
+                return false;
+            });
+            const auto numKept = entries.size();
+            for (auto& industry : IndustryManager::industries())
+            {
+                if (!isListed.test(enumValue(industry.id())))
                 {
-                    chosenIndustry = industry.id();
+                    entries.push_back(getSortEntry(mode, industry));
                 }
             }
 
-            if (chosenIndustry != IndustryId::null)
+            // Values are cheap to refresh every tick, formatted names and statuses are rebuilt a few rows per tick
+            const auto numRefreshed = mode != SortMode::ProductionTransported ? std::min(kSortKeysPerTick, numKept) : numKept;
+            for (size_t i = 0; i < numRefreshed; i++)
             {
-                bool shouldInvalidate = false;
-
-                IndustryManager::get(chosenIndustry)->flags |= IndustryFlags::sorted;
+                auto& entry = entries[(self->frameNo * numRefreshed + i) % numKept];
+                entry = getSortEntry(mode, *IndustryManager::get(entry.id));
+            }
 
-                auto ebp = self->rowCount;
-                if (chosenIndustry != IndustryId(self->rowInfo[ebp]))
-                {
-                    self->rowInfo[ebp] = enumValue(chosenIndustry);
-                    shouldInvalidate = true;
-                }
+            // Stable so that equal industries keep their index order like the original selection sort
+            Utility::insertionSort(entries.begin(), entries.end(), [mode](const SortEntry& lhs, const SortEntry& rhs) { return getOrder(mode, lhs, rhs); });
 
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
+            const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(self->rowInfo)));
+            bool shouldInvalidate = self->var_83C != numRows;
+            for (uint16_t i = 0; i < numRows; i++)
+            {
+                const auto row = enumValue(entries[i].id);
+                if (self->rowInfo[i] != row)
                 {
-                    self->var_83C = self->rowCount;
+                    self->rowInfo[i] = row;
                     shouldInvalidate = true;
                 }
-
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
             }
-            else
-            {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
+            self->rowCount = numRows;
+            self->var_83C = numRows;
 
-                Common::refreshIndustryList(self);
+            if (shouldInvalidate)
+            {
+                self->invalidate();
             }
         }
 
@@ -362,9 +369,6 @@ namespace OpenLoco::Ui::Windows::IndustryList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::industryList, self.number, self.currentTab + Common::widx::tab_industry_list);
 
-            // Add three industries every tick.
-            updateIndustryList(&self);
-            updateIndustryList(&self);
             updateIndustryList(&self);
         }
 
@@ -1351,14 +1355,11 @@ namespace OpenLoco::Ui::Windows::IndustryList
         }
 
         // 0x00457964
+        // Rebuilds the list from scratch when how it is sorted changes
         static void refreshIndustryList(Window* window)
         {
-            window->rowCount = 0;
-
-            for (auto& industry : IndustryManager::industries())
-            {
-                industry.flags &= ~IndustryFlags::sorted;
-            }
+            IndustryList::_sortEntries.clear();
+            IndustryList::updateIndustryList(window);
         }
     }
 }
@@ -20,6 +20,12 @@
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Utility/Collection.hpp>
+#include <algorithm>
+#include <bitset>
+#include <map>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -93,166 +99,160 @@ namespace OpenLoco::Ui::Windows::StationList
         CargoAccepted,
     };
 
-    // 0x004910E8
-    static void refreshStationList(Window* window)
-    {
-        window->rowCount = 0;
+    // Formatted keys are only rebuilt for this many rows per tick
+    static constexpr size_t kSortKeysPerTick = 16;
 
-        for (auto& station : StationManager::stations())
-        {
-            if (station.owner == CompanyId(window->number))
-            {
-                station.flags &= ~StationFlags::flag_4;
-            }
-        }
-    }
-
-    // 0x004911FD
-    static bool orderByName(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    // Keys are built once per station rather than on every comparison
+    struct SortEntry
     {
-        char lhsString[256] = { 0 };
-        StringManager::formatString(lhsString, lhs.name, (void*)&lhs.town);
-
-        char rhsString[256] = { 0 };
-        StringManager::formatString(rhsString, rhs.name, (void*)&rhs.town);
-
-        return strcmp(lhsString, rhsString) < 0;
-    }
-
-    // 0x00491281, 0x00491247
-    static bool orderByQuantity(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
-    {
-        uint32_t lhsSum = 0;
-        for (const auto& cargo : lhs.cargoStats)
-        {
-            lhsSum += cargo.quantity;
-        }
+        StationId id;
+        std::string name;
+        uint32_t value;
+    };
 
-        uint32_t rhsSum = 0;
-        for (const auto& cargo : rhs.cargoStats)
-        {
-            rhsSum += cargo.quantity;
-        }
+    // Rows of each open list by company, kept sorted across ticks
+    static std::map<uint16_t, std::vector<SortEntry>> _sortEntries;
 
-        return rhsSum < lhsSum;
-    }
-
-    // 0x004912BB
-    static bool orderByAccepts(const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    // 0x004911FD, 0x00491247, 0x00491281, 0x004912BB
+    static SortEntry getSortEntry(const SortMode mode, const OpenLoco::Station& station)
     {
-        char* ptr;
-
-        char lhsString[256] = { 0 };
-        ptr = &lhsString[0];
-        for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
+        SortEntry entry{ station.id(), {}, 0 };
+        switch (mode)
         {
-            if (lhs.cargoStats[cargoId].isAccepted())
+            case SortMode::Name:
             {
-                ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
+                char buffer[256] = { 0 };
+                StringManager::formatString(buffer, station.name, (void*)&station.town);
+                entry.name = buffer;
+                break;
             }
-        }
 
-        char rhsString[256] = { 0 };
-        ptr = &rhsString[0];
-        for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
-        {
-            if (rhs.cargoStats[cargoId].isAccepted())
+            case SortMode::Status:
+            case SortMode::TotalUnitsWaiting:
+                for (const auto& cargo : station.cargoStats)
+                {
+                    entry.value += cargo.quantity;
+                }
+                break;
+
+            case SortMode::CargoAccepted:
             {
-                ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
+                char buffer[256] = { 0 };
+                char* ptr = &buffer[0];
+                for (uint32_t cargoId = 0; cargoId < kMaxCargoStats; cargoId++)
+                {
+                    if (station.cargoStats[cargoId].isAccepted())
+                    {
+                        ptr = StringManager::formatString(ptr, ObjectManager::get<CargoObject>(cargoId)->name);
+                    }
+                }
+                entry.name = buffer;
+                break;
             }
         }
+        return entry;
+    }
 
-        return strcmp(lhsString, rhsString) < 0;
+    static bool isKeyFormatted(const SortMode mode)
+    {
+        return mode == SortMode::Name || mode == SortMode::CargoAccepted;
     }
 
-    // 0x004911FD, 0x00491247, 0x00491281, 0x004912BB
-    static bool getOrder(const SortMode mode, const OpenLoco::Station& lhs, const OpenLoco::Station& rhs)
+    static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
     {
         switch (mode)
         {
             case SortMode::Name:
-                return orderByName(lhs, rhs);
+            case SortMode::CargoAccepted:
+                return strcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
 
             case SortMode::Status:
             case SortMode::TotalUnitsWaiting:
-                return orderByQuantity(lhs, rhs);
-
-            case SortMode::CargoAccepted:
-                return orderByAccepts(lhs, rhs);
+                return rhs.value < lhs.value;
         }
 
         return false;
     }
 
-    // 0x0049111A
-    static void updateStationList(Window* window)
+    static bool isStationListed(const Window* window, const OpenLoco::Station& station)
     {
-        StationId edi = StationId::null;
+        if (station.empty() || station.owner != CompanyId(window->number))
+            return false;
 
-        for (auto& station : StationManager::stations())
-        {
-            if (station.owner != CompanyId(window->number))
-                continue;
-
-            if ((station.flags & StationFlags::flag_5) != StationFlags::none)
-                continue;
+        if ((station.flags & StationFlags::flag_5) != StationFlags::none)
+            return false;
 
-            const StationFlags mask = tabInformationByType[window->currentTab].stationMask;
-            if ((station.flags & mask) == StationFlags::none)
-                continue;
+        const StationFlags mask = tabInformationByType[window->currentTab].stationMask;
+        return (station.flags & mask) != StationFlags::none;
+    }
 
-            if ((station.flags & StationFlags::flag_4) != StationFlags::none)
-                continue;
+    // 0x0049111A
+    // Called every tick. The rows are kept from the last tick, so refreshing the keys and an insertion sort
+    // is enough to move the few rows whose values changed into place.
+    static void updateStationList(Window* window)
+    {
+        const auto mode = SortMode(window->sortMode);
+        auto& entries = _sortEntries[window->number];
 
-            if (edi == StationId::null)
+        // Drop stations that are no longer listed, new ones are added at the end and sorted into place
+        std::bitset<Limits::kMaxStations> isListed;
+        std::erase_if(entries, [window, &isListed](const SortEntry& entry) {
+            if (!isStationListed(window, *StationManager::get(entry.id)))
             {
-                edi = station.id();
-                continue;
+                return true;
             }
-
-            if (getOrder(SortMode(window->sortMode), station, *StationManager::get(edi)))
+            isListed.set(enumValue(entry.id));
+            return false;
+        });
+        const auto numKept = entries.size();
+        for (auto& station : StationManager::stations())
+        {
+            if (!isListed.test(enumValue(station.id())) && isStationListed(window, station))
             {
-                edi = station.id();
+                entries.push_back(getSortEntry(mode, station));
             }
         }
 
-        if (edi != StationId::null)
+        // Values are cheap to refresh every tick, formatted keys only change on renames so a few rows are
+        // rebuilt each tick
+        const auto numRefreshed = isKeyFormatted(mode) ? std::min(kSortKeysPerTick, numKept) : numKept;
+        for (size_t i = 0; i < numRefreshed; i++)
         {
-            bool dl = false;
-
-            StationManager::get(edi)->flags |= StationFlags::flag_4;
-
-            auto ebp = window->rowCount;
-            if (edi != StationId(window->rowInfo[ebp]))
-            {
-                window->rowInfo[ebp] = enumValue(edi);
-                dl = true;
-            }
+            auto& entry = entries[(window->frameNo * numRefreshed + i) % numKept];
+            entry = getSortEntry(mode, *StationManager::get(entry.id));
+        }
 
-            window->rowCount += 1;
-            if (window->rowCount > window->var_83C)
-            {
-                window->var_83C = window->rowCount;
-                dl = true;
-            }
+        // Stable so that equal stations keep their index order like the original selection sort
+        Utility::insertionSort(entries.begin(), entries.end(), [mode](const SortEntry& lhs, const SortEntry& rhs) { return getOrder(mode, lhs, rhs); });
 
-            if (dl)
-            {
-                window->invalidate();
-            }
-        }
-        else
+        const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(window->rowInfo)));
+        bool shouldInvalidate = window->var_83C != numRows;
+        for (uint16_t i = 0; i < numRows; i++)
         {
-            if (window->var_83C != window->rowCount)
+            const auto row = enumValue(entries[i].id);
+            if (window->rowInfo[i] != row)
             {
-                window->var_83C = window->rowCount;
-                window->invalidate();
+                window->rowInfo[i] = row;
+                shouldInvalidate = true;
             }
+        }
+        window->rowCount = numRows;
+        window->var_83C = numRows;
 
-            refreshStationList(window);
+        if (shouldInvalidate)
+        {
+            window->invalidate();
         }
     }
 
+    // 0x004910E8
+    // Rebuilds the list from scratch when what is listed or how it is sorted changes
+    static void refreshStationList(Window* window)
+    {
+        _sortEntries[window->number].clear();
+        updateStationList(window);
+    }
+
     // 0x004910AB
     void removeStationFromList(const StationId stationId)
     {
@@ -583,11 +583,8 @@ namespace OpenLoco::Ui::Windows::StationList
         window.number = enumValue(companyId);
         window.owner = companyId;
         window.sortMode = 0;
-        window.rowCount = 0;
-
         refreshStationList(&window);
 
-        window.var_83C = 0;
         window.rowHover = -1;
 
         window.callOnResize();
@@ -698,9 +695,6 @@ namespace OpenLoco::Ui::Windows::StationList
         window.callPrepareDraw();
         WindowManager::invalidateWidget(WindowType::stationList, window.number, window.currentTab + 4);
 
-        // Add three stations every tick.
-        updateStationList(&window);
-        updateStationList(&window);
         updateStationList(&window);
     }
 
@@ -29,6 +29,11 @@
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Utility/Collection.hpp>
+#include <algorithm>
+#include <bitset>
+#include <string>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -113,6 +118,9 @@ namespace OpenLoco::Ui::Windows::TownList
             Stations,
         };
 
+        // Formatted keys are only rebuilt for this many rows per tick
+        static constexpr size_t kSortKeysPerTick = 16;
+
         // 0x00499F53
         static void prepareDraw(Ui::Window& self)
         {
@@ -298,130 +306,112 @@ namespace OpenLoco::Ui::Windows::TownList
             self.invalidate();
         }
 
-        // 0x00499EC9
-        static bool orderByName(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
-        {
-            char lhsString[256] = { 0 };
-            StringManager::formatString(lhsString, lhs.name);
-
-            char rhsString[256] = { 0 };
-            StringManager::formatString(rhsString, rhs.name);
-
-            return strcmp(lhsString, rhsString) < 0;
-        }
-
-        // 0x00499F28
-        static bool orderByPopulation(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
-        {
-            auto lhsPopulation = lhs.population;
-
-            auto rhsPopulation = rhs.population;
-
-            return rhsPopulation < lhsPopulation;
-        }
-
-        // 0x00499F0A Left this in to match the x86 code. can be replaced with orderByPopulation
-        static bool orderByType(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
+        // Keys are built once per town rather than on every comparison
+        struct SortEntry
         {
-            auto lhsSize = lhs.size;
-
-            auto rhsSize = rhs.size;
-
-            if (rhsSize != lhsSize)
-            {
-                return rhsSize < lhsSize;
-            }
-            else
-            {
-                return orderByPopulation(lhs, rhs);
-            }
-        }
-
-        // 0x00499F3B
-        static bool orderByStations(const OpenLoco::Town& lhs, const OpenLoco::Town& rhs)
-        {
-            auto lhsStations = lhs.numStations;
-
-            auto rhsStations = rhs.numStations;
+            TownId id;
+            std::string name;
+            uint64_t value;
+        };
 
-            return rhsStations < lhsStations;
-        }
+        // Rows of the list, kept sorted across ticks
+        static std::vector<SortEntry> _sortEntries;
 
         // 0x00499EC9, 0x00499F0A, 0x00499F28, 0x00499F3B
-        static bool getOrder(const SortMode mode, OpenLoco::Town& lhs, OpenLoco::Town& rhs)
+        static SortEntry getSortEntry(const SortMode mode, const OpenLoco::Town& town)
         {
+            SortEntry entry{ town.id(), {}, 0 };
             switch (mode)
             {
                 case SortMode::Name:
-                    return orderByName(lhs, rhs);
+                {
+                    char buffer[256] = { 0 };
+                    StringManager::formatString(buffer, town.name);
+                    entry.name = buffer;
+                    break;
+                }
 
                 case SortMode::Type:
-                    return orderByType(lhs, rhs);
+                    // Size first, then population
+                    entry.value = (static_cast<uint64_t>(enumValue(town.size)) << 32) | town.population;
+                    break;
 
                 case SortMode::Population:
-                    return orderByPopulation(lhs, rhs);
+                    entry.value = town.population;
+                    break;
 
                 case SortMode::Stations:
-                    return orderByStations(lhs, rhs);
+                    entry.value = town.numStations;
+                    break;
             }
+            return entry;
+        }
 
-            return false;
+        static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
+        {
+            if (mode == SortMode::Name)
+            {
+                return strcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
+            }
+            // Every other mode lists the largest value first
+            return rhs.value < lhs.value;
         }
 
         // 0x00499E0B
+        // Called every tick. The rows are kept from the last tick, so refreshing the keys and an insertion sort
+        // is enough to move the few rows whose values changed into place.
         static void updateTownList(Window* self)
         {
-            TownId chosenTown = TownId::null;
-            for (auto& town : TownManager::towns())
-            {
-                if ((town.flags & TownFlags::sorted) != TownFlags::none)
-                    continue;
+            const auto mode = SortMode(self->sortMode);
+            auto& entries = _sortEntries;
 
-                if (chosenTown == TownId::null)
+            // Drop removed towns, new ones are added at the end and sorted into place
+            std::bitset<Limits::kMaxTowns> isListed;
+            std::erase_if(entries, [&isListed](const SortEntry& entry) {
+                if (TownManager::get(entry.id)->empty())
                 {
-                    chosenTown = town.id();
-                    continue;
+                    return true;
                 }
-
-                if (getOrder(SortMode(self->sortMode), town, *TownManager::get(chosenTown)))
+                isListed.set(enumValue(entry.id));
+                return false;
+            });
+            const auto numKept = entries.size();
+            for (auto& town : TownManager::towns())
+            {
+                if (!isListed.test(enumValue(town.id())))
                 {
-                    chosenTown = town.id();
+                    entries.push_back(getSortEntry(mode, town));
                 }
             }
 
-            if (chosenTown != TownId::null)
+            // Values are cheap to refresh every tick, names only change on renames so a few rows are rebuilt each tick
+            const auto numRefreshed = mode == SortMode::Name ? std::min(kSortKeysPerTick, numKept) : numKept;
+            for (size_t i = 0; i < numRefreshed; i++)
             {
-                bool shouldInvalidate = false;
-
-                TownManager::get(chosenTown)->flags |= TownFlags::sorted;
+                auto& entry = entries[(self->frameNo * numRefreshed + i) % numKept];
+                entry = getSortEntry(mode, *TownManager::get(entry.id));
+            }
 
-                if (chosenTown != TownId(self->rowInfo[self->rowCount]))
-                {
-                    self->rowInfo[self->rowCount] = enumValue(chosenTown);
-                    shouldInvalidate = true;
-                }
+            // Stable so that equal towns keep their index order like the original selection sort
+            Utility::insertionSort(entries.begin(), entries.end(), [mode](const SortEntry& lhs, const SortEntry& rhs) { return getOrder(mode, lhs, rhs); });
 
-                self->rowCount += 1;
-                if (self->rowCount > self->var_83C)
+            const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(self->rowInfo)));
+            bool shouldInvalidate = self->var_83C != numRows;
+            for (uint16_t i = 0; i < numRows; i++)
+            {
+                const auto row = enumValue(entries[i].id);
+                if (self->rowInfo[i] != row)
                 {
-                    self->var_83C = self->rowCount;
+                    self->rowInfo[i] = row;
                     shouldInvalidate = true;
                 }
-
-                if (shouldInvalidate)
-                {
-                    self->invalidate();
-                }
             }
-            else
-            {
-                if (self->var_83C != self->rowCount)
-                {
-                    self->var_83C = self->rowCount;
-                    self->invalidate();
-                }
+            self->rowCount = numRows;
+            self->var_83C = numRows;
 
-                Common::refreshTownList(self);
+            if (shouldInvalidate)
+            {
+                self->invalidate();
             }
         }
 
@@ -433,9 +423,6 @@ namespace OpenLoco::Ui::Windows::TownList
             self.callPrepareDraw();
             WindowManager::invalidateWidget(WindowType::townList, self.number, self.currentTab + Common::widx::tab_town_list);
 
-            // Add three towns every tick.
-            updateTownList(&self);
-            updateTownList(&self);
             updateTownList(&self);
         }
 
@@ -1672,14 +1659,11 @@ namespace OpenLoco::Ui::Windows::TownList
         }
 
         // 0x00499DDE
+        // Rebuilds the list from scratch when how it is sorted changes
         static void refreshTownList(Window* self)
         {
-            self->rowCount = 0;
-
-            for (auto& town : TownManager::towns())
-            {
-                town.flags &= ~TownFlags::sorted;
-            }
+            TownList::_sortEntries.clear();
+            TownList::updateTownList(self);
         }
     }
 }
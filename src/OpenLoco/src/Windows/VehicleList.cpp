@@ -24,9 +24,15 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Utility/Collection.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
+#include <bitset>
+#include <map>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 
@@ -97,6 +103,9 @@ namespace OpenLoco::Ui::Windows::VehicleList
         Reliability,
     };
 
+    // Formatted keys are only rebuilt for this many rows per tick
+    static constexpr size_t kSortKeysPerTick = 16;
+
     enum FilterMode : uint8_t
     {
         allVehicles,
@@ -179,158 +188,151 @@ namespace OpenLoco::Ui::Windows::VehicleList
         return false;
     }
 
-    // 0x004C1D4F
-    static void refreshVehicleList(Window* self)
+    static bool isVehicleListed(const Window* self, const VehicleHead* vehicle)
     {
-        refreshActiveStation(self);
-        self->rowCount = 0;
-        for (auto* vehicle : VehicleManager::VehicleList())
-        {
-            if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
-                continue;
-
-            if (vehicle->owner != CompanyId(self->number))
-                continue;
-
-            if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
-                continue;
-
-            if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
-                continue;
+        if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
+            return false;
 
-            vehicle->vehicleFlags &= ~VehicleFlags::sorted;
-        }
-    }
+        if (vehicle->owner != CompanyId(self->number))
+            return false;
 
-    // 0x004C1E4F
-    static bool orderByName(const VehicleHead& lhs, const VehicleHead& rhs)
-    {
-        char lhsString[256] = { 0 };
-        FormatArguments lhsArgs{};
-        lhsArgs.push(lhs.ordinalNumber);
-        StringManager::formatString(lhsString, lhs.name, &lhsArgs);
+        if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
+            return false;
 
-        char rhsString[256] = { 0 };
-        FormatArguments rhsArgs{};
-        rhsArgs.push(rhs.ordinalNumber);
-        StringManager::formatString(rhsString, rhs.name, &rhsArgs);
+        if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
+            return false;
 
-        return Utility::strlogicalcmp(lhsString, rhsString) < 0;
+        return true;
     }
 
-    // 0x004C1EC9
-    static bool orderByProfit(const VehicleHead& lhs, const VehicleHead& rhs)
+    // Keys are built once per vehicle rather than on every comparison
+    struct SortEntry
     {
-        auto profitL = Vehicles::Vehicle(lhs).veh2->totalRecentProfit();
-        auto profitR = Vehicles::Vehicle(rhs).veh2->totalRecentProfit();
+        EntityId id;
+        std::string name;
+        int64_t value;
+    };
 
-        return profitR - profitL < 0;
-    }
+    // Rows of each open list by company, kept sorted across ticks
+    static std::map<uint16_t, std::vector<SortEntry>> _sortEntries;
 
-    // 0x004C1F1E
-    static bool orderByAge(const VehicleHead& lhs, const VehicleHead& rhs)
+    // 0x004C1E4F, 0x004C1EC9, 0x004C1F1E, 0x004C1F45
+    static SortEntry getSortEntry(const SortMode mode, const VehicleHead& head)
     {
-        auto dayCreatedL = Vehicles::Vehicle(lhs).veh1->dayCreated;
-        auto dayCreatedR = Vehicles::Vehicle(rhs).veh1->dayCreated;
+        SortEntry entry{ head.id, {}, 0 };
+        switch (mode)
+        {
+            case SortMode::Name:
+            {
+                char buffer[256] = { 0 };
+                FormatArguments args{};
+                args.push(head.ordinalNumber);
+                StringManager::formatString(buffer, head.name, &args);
+                entry.name = buffer;
+                break;
+            }
 
-        return static_cast<int32_t>(dayCreatedL - dayCreatedR) < 0;
-    }
+            case SortMode::Profit:
+                entry.value = Vehicles::Vehicle(head).veh2->totalRecentProfit();
+                break;
 
-    // 0x004C1F45
-    static bool orderByReliability(const VehicleHead& lhs, const VehicleHead& rhs)
-    {
-        auto reliabilityL = Vehicles::Vehicle(lhs).veh2->reliability;
-        auto reliabilityR = Vehicles::Vehicle(rhs).veh2->reliability;
+            case SortMode::Age:
+                entry.value = Vehicles::Vehicle(head).veh1->dayCreated;
+                break;
 
-        return static_cast<int32_t>(reliabilityR - reliabilityL) < 0;
+            case SortMode::Reliability:
+                entry.value = Vehicles::Vehicle(head).veh2->reliability;
+                break;
+        }
+        return entry;
     }
 
-    static bool getOrder(const SortMode mode, const VehicleHead& lhs, const VehicleHead& rhs)
+    static bool getOrder(const SortMode mode, const SortEntry& lhs, const SortEntry& rhs)
     {
         switch (mode)
         {
             case SortMode::Name:
-                return orderByName(lhs, rhs);
-
-            case SortMode::Profit:
-                return orderByProfit(lhs, rhs);
+                return Utility::strlogicalcmp(lhs.name.c_str(), rhs.name.c_str()) < 0;
 
             case SortMode::Age:
-                return orderByAge(lhs, rhs);
+                // Oldest first
+                return lhs.value < rhs.value;
 
+            case SortMode::Profit:
             case SortMode::Reliability:
-                return orderByReliability(lhs, rhs);
+                return rhs.value < lhs.value;
         }
 
         return false;
     }
 
-    // 0x004C1D92
-    static void updateVehicleList(Window* self)
+    static const VehicleHead* getListedVehicle(const Window* self, EntityId id)
     {
-        EntityId insertId = EntityId::null;
-
-        for (auto* vehicle : VehicleManager::VehicleList())
-        {
-            if (vehicle->vehicleType != static_cast<VehicleType>(self->currentTab))
-                continue;
+        auto* vehicle = EntityManager::get<Vehicles::VehicleBase>(id);
+        if (vehicle == nullptr || !vehicle->isVehicleHead())
+            return nullptr;
 
-            if (vehicle->owner != CompanyId(self->number))
-                continue;
+        auto* head = vehicle->asVehicleHead();
+        if (!isVehicleListed(self, head))
+            return nullptr;
 
-            if (vehicle->hasVehicleFlags(VehicleFlags::sorted))
-                continue;
-
-            if (isStationFilterActive(self) && !vehicleStopsAtActiveStation(vehicle, StationId(self->var_88C)))
-                continue;
+        return head;
+    }
 
-            if (isCargoFilterActive(self) && !vehicleIsTransportingCargo(vehicle, self->var_88C))
-                continue;
+    // Called every tick. The rows are kept from the last tick, so refreshing the keys and an insertion sort
+    // is enough to move the few rows whose values changed into place.
+    static void updateVehicleList(Window* self)
+    {
+        refreshActiveStation(self);
 
-            if (insertId == EntityId::null)
-            {
-                insertId = vehicle->id;
-                continue;
-            }
+        const auto mode = SortMode(self->sortMode);
+        auto& entries = _sortEntries[self->number];
 
-            auto* insertVehicle = EntityManager::get<VehicleHead>(insertId);
-            if (insertVehicle == nullptr)
+        // Drop vehicles that are no longer listed, new ones are added at the end and sorted into place
+        std::bitset<Limits::kMaxEntities> isListed;
+        std::erase_if(entries, [self, &isListed](const SortEntry& entry) {
+            if (getListedVehicle(self, entry.id) == nullptr)
             {
-                continue;
+                return true;
             }
-            if (getOrder(SortMode(self->sortMode), *vehicle, *insertVehicle))
+            isListed.set(enumValue(entry.id));
+            return false;
+        });
+        const auto numKept = entries.size();
+        for (auto* vehicle : VehicleManager::VehicleList())
+        {
+            if (!isListed.test(enumValue(vehicle->id)) && isVehicleListed(self, vehicle))
             {
-                insertId = vehicle->id;
-                continue;
+                entries.push_back(getSortEntry(mode, *vehicle));
             }
         }
 
-        if (insertId != EntityId::null)
+        // Values are cheap to refresh every tick, names only change on renames so a few rows are rebuilt each tick
+        const auto numRefreshed = mode == SortMode::Name ? std::min(kSortKeysPerTick, numKept) : numKept;
+        for (size_t i = 0; i < numRefreshed; i++)
         {
-            auto vehicle = EntityManager::get<VehicleHead>(insertId);
-            if (vehicle == nullptr)
-            {
-                self->var_83C = self->rowCount;
-                refreshVehicleList(self);
-                return;
-            }
-            vehicle->vehicleFlags |= VehicleFlags::sorted;
-
-            if (vehicle->id != EntityId(self->rowInfo[self->rowCount]))
-                self->rowInfo[self->rowCount] = enumValue(vehicle->id);
+            auto& entry = entries[(self->frameNo * numRefreshed + i) % numKept];
+            entry = getSortEntry(mode, *getListedVehicle(self, entry.id));
+        }
 
-            self->rowCount++;
+        // Stable so that equal vehicles keep their list order like the original selection sort
+        Utility::insertionSort(entries.begin(), entries.end(), [mode](const SortEntry& lhs, const SortEntry& rhs) { return getOrder(mode, lhs, rhs); });
 
-            if (self->rowCount > self->var_83C)
-                self->var_83C = self->rowCount;
-        }
-        else
+        const auto numRows = static_cast<uint16_t>(std::min(entries.size(), std::size(self->rowInfo)));
+        for (uint16_t i = 0; i < numRows; i++)
         {
-            if (self->var_83C != self->rowCount)
-                self->var_83C = self->rowCount;
-
-            refreshVehicleList(self);
+            self->rowInfo[i] = enumValue(entries[i].id);
         }
+        self->rowCount = numRows;
+        self->var_83C = numRows;
+    }
+
+    // 0x004C1D4F
+    // Rebuilds the list from scratch when what is listed or how it is sorted changes
+    static void refreshVehicleList(Window* self)
+    {
+        _sortEntries[self->number].clear();
+        updateVehicleList(self);
     }
 
     // 0x004C2A6E
@@ -832,10 +834,8 @@ namespace OpenLoco::Ui::Windows::VehicleList
         if (self->width < 220)
             self->width = 220;
 
-        self->rowCount = 0;
         refreshVehicleList(self);
 
-        self->var_83C = 0;
         self->rowHover = -1;
 
         self->callOnResize();
@@ -952,10 +952,8 @@ namespace OpenLoco::Ui::Windows::VehicleList
 
         disableUnavailableVehicleTypes(self);
 
-        self->rowCount = 0;
         refreshVehicleList(self);
 
-        self->var_83C = 0;
         self->rowHover = -1;
 
         self->callOnResize();
@@ -1001,8 +999,6 @@ namespace OpenLoco::Ui::Windows::VehicleList
         auto widgetIndex = getTabFromType(static_cast<VehicleType>(self.currentTab));
         WindowManager::invalidateWidget(WindowType::vehicleList, self.number, widgetIndex);
 
-        updateVehicleList(&self);
-        updateVehicleList(&self);
         updateVehicleList(&self);
 
         self.invalidate();
@@ -56,12 +56,16 @@ namespace OpenLoco::CompanyManager
         return getGameState().playerCompanies;
     }
 
+    // Companies that may be in use, lets companies() skip the empty ones without reading them
+    static FixedVector<Company, Limits::kMaxCompanies>::Occupancy _occupancy;
+
     // 0x0042F7F8
     void reset()
     {
         // First, empty all non-empty companies.
-        for (auto& company : companies())
+        for (auto& company : rawCompanies())
             company.name = StringIds::empty;
+        _occupancy.reset();
 
         getGameState().produceAICompanyTimeout = 0;
 
@@ -146,9 +150,17 @@ namespace OpenLoco::CompanyManager
         getGameState().companyRecords = records;
     }
 
+    void rebuildOccupancy()
+    {
+        for (size_t i = 0; i < Limits::kMaxCompanies; i++)
+        {
+            _occupancy.set(i, !rawCompanies()[i].empty());
+        }
+    }
+
     FixedVector<Company, Limits::kMaxCompanies> companies()
     {
-        return FixedVector(rawCompanies());
+        return FixedVector(rawCompanies(), _occupancy);
     }
 
     Company* get(CompanyId id)
@@ -290,6 +302,8 @@ namespace OpenLoco::CompanyManager
         regs.dl = competitorId;
         regs.dh = isPlayer ? 1 : 0;
         call(0x0042FE06, regs);
+        // The company is allocated by the original code
+        rebuildOccupancy();
         return static_cast<CompanyId>(regs.al);
     }
 
@@ -26,6 +26,8 @@ namespace OpenLoco::CompanyManager
     uint16_t getStartingLoanSize();
     void setStartingLoanSize(uint16_t loanSize);
 
+    // Call after the companies have been replaced outside of CompanyManager, e.g. by loading a game
+    void rebuildOccupancy();
     FixedVector<Company, Limits::kMaxCompanies> companies();
     Company* get(CompanyId id);
     CompanyId getControllingId();
@@ -26,6 +26,9 @@
 namespace OpenLoco::IndustryManager
 {
     static auto& rawIndustries() { return getGameState().industries; }
+
+    // Industries that may be in use, lets industries() skip the empty ones without reading them
+    static FixedVector<Industry, Limits::kMaxIndustries>::Occupancy _occupancy;
     static auto getTotalIndustriesCap() { return getGameState().numberOfIndustries; }
     Flags getFlags() { return getGameState().industryFlags; }
 
@@ -65,12 +68,21 @@ namespace OpenLoco::IndustryManager
         {
             industry.name = StringIds::null;
         }
+        _occupancy.reset();
         Ui::Windows::IndustryList::reset();
     }
 
+    void rebuildOccupancy()
+    {
+        for (size_t i = 0; i < Limits::kMaxIndustries; i++)
+        {
+            _occupancy.set(i, !rawIndustries()[i].empty());
+        }
+    }
+
     FixedVector<Industry, Limits::kMaxIndustries> industries()
     {
-        return FixedVector(rawIndustries());
+        return FixedVector(rawIndustries(), _occupancy);
     }
 
     Industry* get(IndustryId id)
@@ -611,6 +623,7 @@ namespace OpenLoco::IndustryManager
 
             industry->town = nearbyTown;
             industry->name = indObj->var_02;
+            _occupancy.set(i, true);
 
             for (auto& innerInd : IndustryManager::industries())
             {
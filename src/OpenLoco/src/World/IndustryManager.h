@@ -19,6 +19,8 @@ namespace OpenLoco::IndustryManager
     OPENLOCO_ENABLE_ENUM_OPERATORS(Flags);
 
     void reset();
+    // Call after the industries have been replaced outside of IndustryManager, e.g. by loading a game
+    void rebuildOccupancy();
     FixedVector<Industry, Limits::kMaxIndustries> industries();
     Industry* get(IndustryId id);
     Flags getFlags();
@@ -27,6 +27,7 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Math/Bound.hpp>
 #include <algorithm>
+#include <array>
 #include <cassert>
 
 using namespace OpenLoco::Interop;
@@ -40,10 +41,28 @@ namespace OpenLoco
     constexpr uint8_t kMaxCargoRating = 200;
     constexpr uint8_t catchmentSize = 4;
 
+    // Inclusive tile bounds, empty when min is greater than max
+    struct CatchmentBounds
+    {
+        tile_coord_t minX;
+        tile_coord_t minY;
+        tile_coord_t maxX;
+        tile_coord_t maxY;
+
+        constexpr bool isEmpty() const { return minX > maxX || minY > maxY; }
+    };
+
+    static constexpr CatchmentBounds kEmptyCatchmentBounds = { kMapColumns, kMapRows, -1, -1 };
+    static constexpr CatchmentBounds kFullCatchmentBounds = { 0, 0, kMapColumns - 1, kMapRows - 1 };
+
     struct CargoSearchState
     {
     private:
         inline static loco_global<uint8_t[kMapSize], 0x00F00484> _map;
+        // Bounds of the tiles that may have each catchment flag set in _map. Lets searches and resets visit
+        // just the catchment rather than the whole map. The whole map whenever the contents are unknown,
+        // initially and after vanilla code that writes _map directly, see invalidateCatchmentBounds.
+        inline static std::array<CatchmentBounds, 2> _mapBounds = { kFullCatchmentBounds, kFullCatchmentBounds };
         inline static loco_global<uint32_t, 0x0112C68C> _filter;
         inline static loco_global<uint32_t[kMaxCargoStats], 0x0112C690> _score;
         inline static loco_global<uint32_t, 0x0112C710> _producedCargoTypes;
@@ -64,6 +83,12 @@ namespace OpenLoco
         void setTile(const tile_coord_t x, const tile_coord_t y, const CatchmentFlags flag)
         {
             _map[y * kMapColumns + x] |= (1 << enumValue(flag));
+
+            auto& bounds = _mapBounds[enumValue(flag)];
+            bounds.minX = std::min(bounds.minX, x);
+            bounds.minY = std::min(bounds.minY, y);
+            bounds.maxX = std::max(bounds.maxX, x);
+            bounds.maxY = std::max(bounds.maxY, y);
         }
 
         void resetTile(const tile_coord_t x, const tile_coord_t y, const CatchmentFlags flag)
@@ -93,6 +118,25 @@ namespace OpenLoco
 
         void resetTileRegion(tile_coord_t x, tile_coord_t y, int16_t xTileCount, int16_t yTileCount, const CatchmentFlags flag)
         {
+            // Nothing outside of the bounds can be set so clip the region to them
+            auto& bounds = _mapBounds[enumValue(flag)];
+            const auto clipMinX = std::max(x, bounds.minX);
+            const auto clipMinY = std::max(y, bounds.minY);
+            const auto clipMaxX = std::min<tile_coord_t>(x + xTileCount - 1, bounds.maxX);
+            const auto clipMaxY = std::min<tile_coord_t>(y + yTileCount - 1, bounds.maxY);
+            if (clipMinX > clipMaxX || clipMinY > clipMaxY)
+            {
+                return;
+            }
+            if (clipMinX == bounds.minX && clipMinY == bounds.minY && clipMaxX == bounds.maxX && clipMaxY == bounds.maxY)
+            {
+                bounds = kEmptyCatchmentBounds;
+            }
+            x = clipMinX;
+            y = clipMinY;
+            xTileCount = clipMaxX - clipMinX + 1;
+            yTileCount = clipMaxY - clipMinY + 1;
+
             auto xStart = x;
             auto xTileStartCount = xTileCount;
             while (yTileCount > 0)
@@ -111,6 +155,16 @@ namespace OpenLoco
             }
         }
 
+        CatchmentBounds getBounds(const CatchmentFlags flag) const
+        {
+            return _mapBounds[enumValue(flag)];
+        }
+
+        static void invalidateBounds()
+        {
+            _mapBounds = { kFullCatchmentBounds, kFullCatchmentBounds };
+        }
+
         uint32_t filter() const
         {
             return _filter;
@@ -281,9 +335,12 @@ namespace OpenLoco
             cargoSearchState.filter(~0U);
         }
 
-        for (tile_coord_t ty = 0; ty < kMapColumns; ty++)
+        // Only the catchment needs searching, iterated in the same order as a full map search as
+        // the last industry found for each cargo is the one that is kept.
+        const auto bounds = cargoSearchState.getBounds(CatchmentFlags::flag_1);
+        for (tile_coord_t ty = bounds.minY; ty <= bounds.maxY; ty++)
         {
-            for (tile_coord_t tx = 0; tx < kMapRows; tx++)
+            for (tile_coord_t tx = bounds.minX; tx <= bounds.maxX; tx++)
             {
                 if (cargoSearchState.mapHas2(tx, ty))
                 {
@@ -491,6 +548,11 @@ namespace OpenLoco
 
     static void setStationCatchmentRegion(CargoSearchState& cargoSearchState, TilePos2 minPos, TilePos2 maxPos, const CatchmentFlags flags);
 
+    void invalidateCatchmentBounds()
+    {
+        CargoSearchState::invalidateBounds();
+    }
+
     // 0x00491D70
     // catchment flag should not be shifted (1, 2, 3, 4) and NOT (1 << 0, 1 << 1)
     void setCatchmentDisplay(const Station* station, const CatchmentFlags catchmentFlag)
@@ -812,12 +874,11 @@ namespace OpenLoco
     // 0x0048F6D4
     StationElement* getStationElement(const Pos3& pos)
     {
-        auto tile = TileManager::get(pos.x, pos.y);
         auto baseZ = pos.z / 4;
 
-        for (auto& element : tile)
+        for (auto* element : TileManager::getTransportElements(World::toTileSpace(pos)))
         {
-            auto* stationElement = element.as<StationElement>();
+            auto* stationElement = element->as<StationElement>();
 
             if (stationElement == nullptr)
             {
@@ -141,6 +141,9 @@ namespace OpenLoco
 #pragma pack(pop)
 
     void setCatchmentDisplay(const Station* station, const CatchmentFlags flags);
+    // The catchment map is also written by vanilla code, which does not track where it set flags. Call whenever
+    // control returns from vanilla code that may have written it so the next search covers the whole map.
+    void invalidateCatchmentBounds();
     struct PotentialCargo
     {
         uint32_t accepted;
@@ -36,6 +36,9 @@ namespace OpenLoco::StationManager
 
     static auto& rawStations() { return getGameState().stations; }
 
+    // Stations that may be in use, lets stations() skip the empty ones without reading them
+    static FixedVector<Station, Limits::kMaxStations>::Occupancy _occupancy;
+
     // 0x0048B1D8
     void reset()
     {
@@ -43,12 +46,21 @@ namespace OpenLoco::StationManager
         {
             station.name = StringIds::null;
         }
+        _occupancy.reset();
         Ui::Windows::Station::reset();
     }
 
+    void rebuildOccupancy()
+    {
+        for (size_t i = 0; i < Limits::kMaxStations; i++)
+        {
+            _occupancy.set(i, !rawStations()[i].empty());
+        }
+    }
+
     FixedVector<Station, Limits::kMaxStations> stations()
     {
-        return FixedVector(rawStations());
+        return FixedVector(rawStations(), _occupancy);
     }
 
     Station* get(StationId id)
@@ -572,6 +584,7 @@ namespace OpenLoco::StationManager
             station.town = maybeTown->first;
             station.owner = owner;
             station.name = generateNewStationName(station.id(), station.town, pos, mode);
+            _occupancy.set(enumValue(station.id()), true);
 
             // Reset cargo stats
             for (auto& stats : station.cargoStats)
@@ -634,6 +647,7 @@ namespace OpenLoco::StationManager
         MessageManager::removeAllSubjectRefs(enumValue(stationId), MessageItemArgumentType::station);
         StringManager::emptyUserString(station->name);
         station->name = StringIds::null;
+        _occupancy.set(enumValue(stationId), false);
     }
 
     void registerHooks()
@@ -644,6 +658,8 @@ namespace OpenLoco::StationManager
             [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
                 registers backup = regs;
                 auto stationId = (reinterpret_cast<Station*>(regs.esi))->id();
+                // Only called for stations just allocated by the original code
+                _occupancy.set(enumValue(stationId), true);
                 const auto newName = generateNewStationName(stationId, TownId(regs.ebx), World::Pos3(regs.ax, regs.cx, regs.dh * World::kSmallZStep), regs.dl);
                 regs = backup;
                 regs.bx = newName;
@@ -10,6 +10,8 @@
 namespace OpenLoco::StationManager
 {
     void reset();
+    // Call after the stations have been replaced outside of StationManager, e.g. by loading a game
+    void rebuildOccupancy();
     FixedVector<Station, Limits::kMaxStations> stations();
     Station* get(StationId id);
     void update();
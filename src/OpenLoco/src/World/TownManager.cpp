@@ -73,6 +73,9 @@ namespace OpenLoco::TownManager
 
     static auto& rawTowns() { return getGameState().towns; }
 
+    // Towns that may be in use, lets towns() skip the empty ones without reading them
+    static FixedVector<Town, Limits::kMaxTowns>::Occupancy _occupancy;
+
     // 0x00497348
     void resetBuildingsInfluence()
     {
@@ -134,12 +137,21 @@ namespace OpenLoco::TownManager
         {
             town.name = StringIds::null;
         }
+        _occupancy.reset();
         Ui::Windows::TownList::reset();
     }
 
+    void rebuildOccupancy()
+    {
+        for (size_t i = 0; i < Limits::kMaxTowns; i++)
+        {
+            _occupancy.set(i, !rawTowns()[i].empty());
+        }
+    }
+
     FixedVector<Town, Limits::kMaxTowns> towns()
     {
-        return FixedVector(rawTowns());
+        return FixedVector(rawTowns(), _occupancy);
     }
 
     Town* get(TownId id)
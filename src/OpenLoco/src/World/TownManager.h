@@ -9,6 +9,8 @@
 namespace OpenLoco::TownManager
 {
     void reset();
+    // Call after towns have been created or replaced outside of TownManager, e.g. by loading a game
+    void rebuildOccupancy();
     FixedVector<Town, Limits::kMaxTowns> towns();
     Town* get(TownId id);
     std::optional<std::pair<TownId, uint8_t>> getClosestTownAndDensity(const World::Pos2& loc);
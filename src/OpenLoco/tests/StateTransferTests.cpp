@@ -0,0 +1,83 @@
+#include "Network/StateTransfer.h"
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+
+using namespace OpenLoco::Network;
+
+static std::vector<uint8_t> makeState(size_t size)
+{
+    std::vector<uint8_t> state(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        // Mix runs and noise so both compressed and uncompressed blocks are produced
+        state[i] = (i / 0x1000) % 2 == 0 ? 0x55 : static_cast<uint8_t>(i * 31 + (i >> 7));
+    }
+    return state;
+}
+
+TEST(StateTransferTests, roundTrip)
+{
+    // Not a multiple of the block size so the last block is partial
+    const auto state = makeState(StateTransfer::kBlockSize * 5 + 123);
+
+    const auto payload = StateTransfer::encode(state, {});
+    const auto decoded = StateTransfer::decode(payload, {}, state.size());
+    EXPECT_EQ(decoded, state);
+}
+
+TEST(StateTransferTests, roundTripEmpty)
+{
+    const auto payload = StateTransfer::encode({}, {});
+    EXPECT_TRUE(payload.empty());
+    EXPECT_TRUE(StateTransfer::decode(payload, {}, 0).empty());
+}
+
+TEST(StateTransferTests, delta)
+{
+    const auto baseline = makeState(StateTransfer::kBlockSize * 8);
+    auto state = baseline;
+    state[StateTransfer::kBlockSize * 2 + 10] ^= 0xFF;
+    state[StateTransfer::kBlockSize * 7] ^= 0xFF;
+
+    const auto full = StateTransfer::encode(state, {});
+    const auto delta = StateTransfer::encode(state, baseline);
+    EXPECT_LT(delta.size(), full.size());
+
+    // Only the two changed blocks are sent, each at most a block plus its headers
+    EXPECT_LE(delta.size(), 2 * (StateTransfer::kBlockSize + 16));
+
+    EXPECT_EQ(StateTransfer::decode(delta, baseline, state.size()), state);
+}
+
+TEST(StateTransferTests, deltaUnchanged)
+{
+    const auto baseline = makeState(StateTransfer::kBlockSize * 3);
+    const auto payload = StateTransfer::encode(baseline, baseline);
+    EXPECT_TRUE(payload.empty());
+    EXPECT_EQ(StateTransfer::decode(payload, baseline, baseline.size()), baseline);
+}
+
+TEST(StateTransferTests, deltaResized)
+{
+    // Blocks beyond the end of a shorter baseline are always sent
+    const auto baseline = makeState(StateTransfer::kBlockSize * 2);
+    auto state = makeState(StateTransfer::kBlockSize * 4);
+    state[0] ^= 0xFF;
+
+    const auto payload = StateTransfer::encode(state, baseline);
+    EXPECT_EQ(StateTransfer::decode(payload, baseline, state.size()), state);
+}
+
+TEST(StateTransferTests, invalidBlock)
+{
+    const auto state = makeState(StateTransfer::kBlockSize * 4);
+    const auto payload = StateTransfer::encode(state, {});
+
+    // Blocks outside of the state are rejected
+    EXPECT_THROW(StateTransfer::decode(payload, {}, StateTransfer::kBlockSize * 2), std::exception);
+
+    // As are truncated payloads
+    const auto truncated = std::vector<uint8_t>(payload.begin(), payload.end() - 1);
+    EXPECT_THROW(StateTransfer::decode(truncated, {}, state.size()), std::exception);
+}
@@ -0,0 +1,82 @@
+#include "Map/TileIndex.h"
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <vector>
+
+using namespace OpenLoco::World;
+
+// Lays out one tile per list of element types, each tile directly after the previous one
+static std::vector<TileElement> makeTiles(std::initializer_list<std::initializer_list<ElementType>> tiles)
+{
+    std::vector<TileElement> elements;
+    for (const auto& types : tiles)
+    {
+        for (const auto type : types)
+        {
+            auto& el = elements.emplace_back();
+            el.setType(type);
+        }
+        elements.back().setLastFlag(true);
+    }
+    return elements;
+}
+
+static bool hasType(const TileIndex::Entry& entry, ElementType type)
+{
+    return (entry.typeMask & (1U << static_cast<uint8_t>(type))) != 0;
+}
+
+TEST(TileIndexTests, build)
+{
+    auto elements = makeTiles({ { ElementType::surface, ElementType::track, ElementType::tree, ElementType::road } });
+    TileIndex index;
+    index.resize(1);
+
+    EXPECT_EQ(index.find(0, elements.data(), elements.data()), nullptr);
+    const auto* entry = index.build(0, elements.data(), elements.data());
+    ASSERT_NE(entry, nullptr);
+    EXPECT_EQ(entry->numElements, 4);
+    EXPECT_EQ(entry->surfaceIndex, 0);
+    EXPECT_TRUE(hasType(*entry, ElementType::tree));
+    EXPECT_FALSE(hasType(*entry, ElementType::building));
+
+    const auto transport = index.getTransportElements(*entry);
+    ASSERT_EQ(transport.size(), 2U);
+    EXPECT_EQ(transport[0], &elements[1]);
+    EXPECT_EQ(transport[1], &elements[3]);
+
+    EXPECT_EQ(index.find(0, elements.data(), elements.data()), entry);
+}
+
+TEST(TileIndexTests, resized)
+{
+    auto elements = makeTiles({ { ElementType::surface, ElementType::tree }, { ElementType::surface } });
+    TileIndex index;
+    index.resize(2);
+    ASSERT_NE(index.build(0, elements.data(), elements.data()), nullptr);
+
+    // Removing an element in place shortens the tile
+    elements[0].setLastFlag(true);
+    EXPECT_EQ(index.find(0, elements.data(), elements.data()), nullptr);
+}
+
+TEST(TileIndexTests, changedInPlace)
+{
+    auto elements = makeTiles({ { ElementType::surface, ElementType::tree } });
+    TileIndex index;
+    index.resize(1);
+    ASSERT_NE(index.build(0, elements.data(), elements.data()), nullptr);
+
+    // Same address and length, as left behind by a remove and insert that is moved back by the vanilla reorganise
+    elements[1].setType(ElementType::road);
+    elements[1].setLastFlag(true);
+    index.clear();
+
+    EXPECT_EQ(index.find(0, elements.data(), elements.data()), nullptr);
+    const auto* entry = index.build(0, elements.data(), elements.data());
+    ASSERT_NE(entry, nullptr);
+    EXPECT_FALSE(hasType(*entry, ElementType::tree));
+    EXPECT_TRUE(hasType(*entry, ElementType::road));
+    ASSERT_EQ(index.getTransportElements(*entry).size(), 1U);
+    EXPECT_EQ(index.getTransportElements(*entry)[0], &elements[1]);
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <iterator>
 
 namespace OpenLoco::Utility
 {
@@ -9,4 +11,30 @@ namespace OpenLoco::Utility
     {
         return N;
     }
+
+    // Stable sort that takes linear time on a range that is already nearly sorted, such as a list that is
+    // re-sorted every tick. Returns true if any element was moved.
+    template<typename TIterator, typename TCompare>
+    static constexpr bool insertionSort(TIterator first, TIterator last, TCompare&& comp)
+    {
+        bool moved = false;
+        if (first == last)
+        {
+            return moved;
+        }
+        for (auto it = std::next(first); it != last; ++it)
+        {
+            auto insertAt = it;
+            while (insertAt != first && comp(*it, *std::prev(insertAt)))
+            {
+                --insertAt;
+            }
+            if (insertAt != it)
+            {
+                std::rotate(insertAt, it, std::next(it));
+                moved = true;
+            }
+        }
+        return moved;
+    }
 }
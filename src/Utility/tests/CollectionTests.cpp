@@ -0,0 +1,33 @@
+#include <OpenLoco/Utility/Collection.hpp>
+#include <gtest/gtest.h>
+#include <utility>
+#include <vector>
+
+using namespace OpenLoco;
+
+TEST(CollectionTests, insertionSort)
+{
+    std::vector<int> values;
+    EXPECT_FALSE(Utility::insertionSort(values.begin(), values.end(), std::less<>()));
+
+    values = { 1, 2, 3, 4 };
+    EXPECT_FALSE(Utility::insertionSort(values.begin(), values.end(), std::less<>()));
+    EXPECT_EQ(values, (std::vector<int>{ 1, 2, 3, 4 }));
+
+    values = { 5, 1, 4, 2, 3 };
+    EXPECT_TRUE(Utility::insertionSort(values.begin(), values.end(), std::less<>()));
+    EXPECT_EQ(values, (std::vector<int>{ 1, 2, 3, 4, 5 }));
+
+    values = { 1, 2, 3, 4 };
+    EXPECT_TRUE(Utility::insertionSort(values.begin(), values.end(), std::greater<>()));
+    EXPECT_EQ(values, (std::vector<int>{ 4, 3, 2, 1 }));
+}
+
+TEST(CollectionTests, insertionSortStable)
+{
+    std::vector<std::pair<int, char>> values = { { 2, 'a' }, { 1, 'b' }, { 2, 'c' }, { 1, 'd' }, { 0, 'e' } };
+    Utility::insertionSort(values.begin(), values.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    const std::vector<std::pair<int, char>> expected = { { 0, 'e' }, { 1, 'b' }, { 1, 'd' }, { 2, 'a' }, { 2, 'c' } };
+    EXPECT_EQ(values, expected);
+}